@@ -1,10 +1,152 @@
 #pragma once
 
-#include <iostream>
+#include <cstdint>
 
-#include "../rash.hpp"
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+#include <cstring>
+
+#include "../tensor.hpp"
 
 namespace rash {
+
+/**
+ * @brief Applies ReLU over a raw buffer in a single pass, recording the sign mask as bits.
+ *
+ * Writes max(0, src[i]) into dst and sets bit i of mask whenever src[i] > 0, so the
+ * backward pass can be replayed without keeping a full double-sized mask tensor around.
+ * Uses the AVX compare/max clone when the running CPU supports it, falling back to a
+ * scalar loop otherwise.
+ *
+ * @param src The input buffer.
+ * @param dst The output buffer (may alias src).
+ * @param n Number of elements.
+ * @param mask Bit mask storage, at least (n + 63) / 64 words, zero-initialized.
+ */
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx"))) inline size_t reluForwardKernelAvx(const double* src, double* dst, size_t n,
+                                                                  uint64_t* mask) {
+    size_t idx = 0;
+    const __m256d zero = _mm256_setzero_pd();
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d v = _mm256_load_pd(src + idx);
+        __m256d gt = _mm256_cmp_pd(v, zero, _CMP_GT_OQ);
+        mask[idx >> 6] |= uint64_t(_mm256_movemask_pd(gt)) << (idx & 63);
+        _mm256_store_pd(dst + idx, _mm256_max_pd(v, zero));
+    }
+    return idx;
+}
+#endif
+
+inline void reluForwardKernel(const double* src, double* dst, size_t n, uint64_t* mask) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = reluForwardKernelAvx(src, dst, n, mask);
+#endif
+    for (; idx < n; ++idx) {
+        if (src[idx] > 0.0) {
+            mask[idx >> 6] |= uint64_t(1) << (idx & 63);
+            dst[idx] = src[idx];
+        } else {
+            dst[idx] = 0.0;
+        }
+    }
+}
+
+/**
+ * @brief Branchless ReLU over int8 (q7) buffers, eight lanes per 64-bit word.
+ *
+ * Quantized forward path for platforms without AVX: each uint64_t word holds eight
+ * int8 lanes, the sign bit of every lane is extended across its byte in SWAR fashion
+ * and negative lanes are zeroed with a single AND - no SIMD intrinsics required.
+ * On ARM the NEON vmaxq_s8 variant is used instead.
+ *
+ * @param src The quantized input buffer.
+ * @param dst The quantized output buffer (may alias src).
+ * @param n Number of elements.
+ */
+inline void reluForwardQ7(const int8_t* src, int8_t* dst, size_t n) {
+    size_t idx = 0;
+#ifdef __ARM_NEON
+    const int8x16_t zero = vdupq_n_s8(0);
+    for (; idx + 16 <= n; idx += 16) {
+        vst1q_s8(dst + idx, vmaxq_s8(vld1q_s8(src + idx), zero));
+    }
+#else
+    for (; idx + 8 <= n; idx += 8) {
+        uint64_t word;
+        std::memcpy(&word, src + idx, sizeof(word));
+        // Extend each lane's sign bit across its byte, then drop negative lanes.
+        uint64_t signs = (word >> 7) & 0x0101010101010101ULL;
+        word &= ~(signs * 0xFFULL);
+        std::memcpy(dst + idx, &word, sizeof(word));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        dst[idx] = src[idx] > 0 ? src[idx] : 0;
+    }
+}
+
+/**
+ * @brief Computes sigmoid over a raw buffer without graph-level temporaries.
+ *
+ * Writing 1 / (1 + exp(-x)) as Tensor expressions allocates a graph node
+ * (data plus gradient bookkeeping) per sub-operation. This kernel sweeps a
+ * single buffer: negate, exp via the runtime-dispatched expKernel, then the
+ * final reciprocal - no intermediate tensors at all.
+ *
+ * @param src The input buffer.
+ * @param dst The output buffer (may alias src).
+ * @param n Number of elements.
+ */
+inline void sigmoidKernel(const double* src, double* dst, size_t n) {
+    for (size_t idx = 0; idx < n; ++idx) {
+        dst[idx] = -src[idx];
+    }
+    expKernel(dst, dst, n);
+    for (size_t idx = 0; idx < n; ++idx) {
+        dst[idx] = 1.0 / (1.0 + dst[idx]);
+    }
+}
+
+/**
+ * @brief Computes row-wise softmax over a raw buffer in three sweeps.
+ *
+ * Max-subtract (for numerical stability), exp and sum-divide all run over the
+ * same output buffer, so the whole softmax costs one allocation instead of
+ * the four separate tensors the equivalent exp / sum / divide expression
+ * graph would create.
+ *
+ * @param src The input buffer.
+ * @param dst The output buffer (may alias src).
+ * @param n Number of elements; must be a multiple of rowLen.
+ * @param rowLen Length of the trailing axis the softmax normalizes over.
+ */
+inline void softmaxKernel(const double* src, double* dst, size_t n, size_t rowLen) {
+    for (size_t base = 0; base < n; base += rowLen) {
+        double rowMax = src[base];
+        for (size_t idx = 1; idx < rowLen; ++idx) {
+            rowMax = std::max(rowMax, src[base + idx]);
+        }
+        for (size_t idx = 0; idx < rowLen; ++idx) {
+            dst[base + idx] = src[base + idx] - rowMax;
+        }
+    }
+    expKernel(dst, dst, n);
+    for (size_t base = 0; base < n; base += rowLen) {
+        double rowSum = 0.0;
+        for (size_t idx = 0; idx < rowLen; ++idx) {
+            rowSum += dst[base + idx];
+        }
+        double invSum = 1.0 / rowSum;
+        for (size_t idx = 0; idx < rowLen; ++idx) {
+            dst[base + idx] *= invSum;
+        }
+    }
+}
+
 /**
  * @brief Abstract base class for activation functions.
  */
@@ -46,17 +188,18 @@ class ReLU : public Activation {
      * @return The output tensor after applying the ReLU activation function.
      */
     virtual Tensor forward(const Tensor& t) override {
-        std::string newTag = "RELU(" + t.impl->tag + ")";
-        TensorMeta mask = t.impl->data_ > 0.0;
-        Tensor out(mask * t.impl->data_, t.impl->requiresGrad, newTag);
+        std::string newTag = composeTag({"RELU(", t.impl->tag, ")"});
+        TensorMeta outMeta(t.impl->data_.shape());
+        size_t n = outMeta.rawData.size();
 
-        out.impl->prev = {t.impl};
-        out.impl->_backward = [mask = mask, out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
+        // Single fused pass: max(0, x) plus a one-bit-per-element sign mask for backward.
+        std::vector<uint64_t> mask((n + 63) / 64, 0);
+        reluForwardKernel(t.impl->data_.rawData.data(), outMeta.rawData.data(), n, mask.data());
+        Tensor out(std::move(outMeta), t.impl->requiresGrad, std::move(newTag));
 
-            if (p0->requiresGrad)
-                p0->accumulateGrad(incGrad * mask);
-        };
+        linkParents(out.impl, t.impl);
+        out.impl->bwdOp = BackwardOp::ReLU;
+        out.impl->bitMask = std::move(mask);
         return out;
     }
 
@@ -64,4 +207,63 @@ class ReLU : public Activation {
     ReLU() = default;
 };
 
+/**
+ * @brief Sigmoid activation function.
+ *
+ * Computes f(x) = 1 / (1 + exp(-x)) as one fused kernel instead of the four
+ * graph nodes the expression form would allocate. No forward state is kept
+ * for backward: the derivative y * (1 - y) is recovered from the output.
+ */
+class Sigmoid : public Activation {
+    /**
+     * @brief Applies the sigmoid activation function to the input tensor.
+     *
+     * @param t The input tensor.
+     * @return The output tensor after applying the sigmoid activation function.
+     */
+    virtual Tensor forward(const Tensor& t) override {
+        std::string newTag = composeTag({"SIGMOID(", t.impl->tag, ")"});
+        TensorMeta outMeta(t.impl->data_.shape());
+        sigmoidKernel(t.impl->data_.rawData.data(), outMeta.rawData.data(), outMeta.rawData.size());
+        Tensor out(std::move(outMeta), t.impl->requiresGrad, std::move(newTag));
+
+        linkParents(out.impl, t.impl);
+        out.impl->bwdOp = BackwardOp::Sigmoid;
+        return out;
+    }
+
+   public:
+    Sigmoid() = default;
+};
+
+/**
+ * @brief Softmax activation function over the trailing axis.
+ *
+ * Computes f(x)_i = exp(x_i) / sum_j exp(x_j) per row of the last dimension,
+ * fused into one output allocation with the stabilizing max-subtract folded
+ * in. Backward reconstructs the Jacobian product from the output alone.
+ */
+class Softmax : public Activation {
+    /**
+     * @brief Applies the softmax activation function to the input tensor.
+     *
+     * @param t The input tensor.
+     * @return The output tensor after applying the softmax activation function.
+     */
+    virtual Tensor forward(const Tensor& t) override {
+        std::string newTag = composeTag({"SOFTMAX(", t.impl->tag, ")"});
+        TensorMeta outMeta(t.impl->data_.shape());
+        size_t rowLen = size_t(outMeta.shape().back());
+        softmaxKernel(t.impl->data_.rawData.data(), outMeta.rawData.data(), outMeta.rawData.size(), rowLen);
+        Tensor out(std::move(outMeta), t.impl->requiresGrad, std::move(newTag));
+
+        linkParents(out.impl, t.impl);
+        out.impl->bwdOp = BackwardOp::Softmax;
+        return out;
+    }
+
+   public:
+    Softmax() = default;
+};
+
 }  // namespace rash
\ No newline at end of file
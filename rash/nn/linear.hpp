@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+
+#include "../tensor.hpp"
+#include "activation.hpp"
+
+namespace rash {
+
+/**
+ * @brief Fused Linear + ReLU layer.
+ *
+ * Computes y = max(0, x @ W + b) as one module instead of chaining a Linear
+ * layer with a separate ReLU. Fusing the two avoids the extra memory round
+ * trip between them: the bias add and the ReLU run in a single pass over the
+ * GEMM output on forward, only a bit-packed sign mask is kept for backward,
+ * and the backward closure produces the input, weight and bias gradients from
+ * one shared masked-gradient tensor.
+ *
+ * The weight is stored as (inFeatures, outFeatures) so the forward pass is a
+ * plain x @ W with no per-call transpose.
+ */
+class LinearReLU {
+   public:
+    Tensor weight, bias;
+
+    /**
+     * @brief Constructs the layer with randomly initialized parameters.
+     *
+     * @param inFeatures Size of each input sample.
+     * @param outFeatures Size of each output sample.
+     * @param tag A tag prefix for identifying the layer parameters.
+     */
+    LinearReLU(int inFeatures, int outFeatures, std::string tag = "linearReLU")
+        : weight(Tensor::rand({inFeatures, outFeatures}, true, tag + ".W")),
+          bias(Tensor::rand({outFeatures}, true, tag + ".b")) {}
+
+    /**
+     * @brief Applies the fused linear transform and ReLU to the input tensor.
+     *
+     * @param t The input tensor of shape (..., inFeatures).
+     * @return The activated output tensor of shape (..., outFeatures).
+     */
+    Tensor forward(const Tensor& t) {
+        std::string newTag = composeTag({"LinearReLU(", t.impl->tag, ")"});
+
+        // GEMM, then bias add + ReLU + mask bit-pack fused into one pass.
+        TensorMeta outMeta = TensorMeta::matmul(t.impl->data_, weight.impl->data_);
+        const AlignedVector& biasRaw = bias.impl->data_.rawData;
+        size_t n = outMeta.rawData.size();
+        size_t outFeatures = biasRaw.size();
+        std::vector<uint64_t> mask((n + 63) / 64, 0);
+        for (size_t idx = 0; idx < n; ++idx) {
+            double val = outMeta.rawData[idx] + biasRaw[idx % outFeatures];
+            if (val > 0.0) {
+                mask[idx >> 6] |= uint64_t(1) << (idx & 63);
+                outMeta.rawData[idx] = val;
+            } else {
+                outMeta.rawData[idx] = 0.0;
+            }
+        }
+
+        bool requiresGrad = t.impl->requiresGrad || weight.impl->requiresGrad || bias.impl->requiresGrad;
+        Tensor out(std::move(outMeta), requiresGrad, std::move(newTag));
+
+        linkParents(out.impl, t.impl, weight.impl, bias.impl);
+        out.impl->bwdOp = BackwardOp::LinearReLU;
+        out.impl->bitMask = std::move(mask);
+        return out;
+    }
+
+    /**
+     * @brief Applies the fused layer to the input tensor.
+     *
+     * @param t The input tensor.
+     * @return The activated output tensor.
+     */
+    Tensor operator()(const Tensor& t) { return forward(t); }
+};
+
+}  // namespace rash
@@ -2,8 +2,11 @@
 
 // NN Lib
 #include "nn/activation.hpp"
+#include "nn/linear.hpp"
+#include "nn/quantLinear.hpp"
 
 // General Tensor Support
+#include "scalarArena.hpp"
 #include "tensor.hpp"
 #include "tensorMeta.hpp"
 #include "utils.hpp"
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace rash {
+
+/**
+ * @brief Structure-of-arrays autograd arena for scalar expression graphs.
+ *
+ * The general Tensor keeps every node on the heap behind a shared_ptr, with a
+ * std::function closure and a TensorMeta per node - well over a hundred bytes
+ * of scattered state for what is, in scalar optimization scripts, a single
+ * double. ScalarArena stores the whole graph as parallel vectors (value,
+ * gradient, opcode, parent ids) indexed by a ScalarId. Nodes are appended in
+ * topological order, so backward is one reverse sweep over contiguous arrays
+ * with a switch on the opcode: no recursion, no type-erased calls, and no
+ * per-node allocations.
+ */
+class ScalarArena {
+   public:
+    using ScalarId = int32_t;
+
+    /**
+     * @brief Opcode of the operation that produced a node.
+     */
+    enum class Op : uint8_t { Leaf, Add, Sub, Mul, Div, Neg, Exp, Pow };
+
+    /**
+     * @brief Creates a leaf node holding a user-supplied value.
+     * @param value The scalar value.
+     * @return The id of the new node.
+     */
+    ScalarId leaf(double value) { return pushNode(Op::Leaf, value, -1, -1); }
+
+    ScalarId add(ScalarId a, ScalarId b) { return pushNode(Op::Add, data_[a] + data_[b], a, b); }
+    ScalarId sub(ScalarId a, ScalarId b) { return pushNode(Op::Sub, data_[a] - data_[b], a, b); }
+    ScalarId mul(ScalarId a, ScalarId b) { return pushNode(Op::Mul, data_[a] * data_[b], a, b); }
+    ScalarId div(ScalarId a, ScalarId b) { return pushNode(Op::Div, data_[a] / data_[b], a, b); }
+    ScalarId neg(ScalarId a) { return pushNode(Op::Neg, -data_[a], a, -1); }
+    ScalarId exp(ScalarId a) { return pushNode(Op::Exp, std::exp(data_[a]), a, -1); }
+
+    /**
+     * @brief Raises a node to an integer power.
+     * @param a The base node.
+     * @param n The exponent, stored in the second parent slot.
+     * @return The id of the new node.
+     */
+    ScalarId pow(ScalarId a, int n) { return pushNode(Op::Pow, std::pow(data_[a], n), a, n); }
+
+    /**
+     * @brief Reads the value of a node.
+     */
+    double data(ScalarId id) const { return data_[id]; }
+
+    /**
+     * @brief Reads the accumulated gradient of a node.
+     */
+    double grad(ScalarId id) const { return grad_[id]; }
+
+    /**
+     * @brief Overwrites the value of a leaf node (e.g. a gradient-descent step).
+     */
+    void updateData(ScalarId id, double value) {
+        assert(op_[id] == Op::Leaf && "Only leaf values can be overwritten!");
+        data_[id] = value;
+    }
+
+    /**
+     * @brief Resets all gradients to zero.
+     */
+    void zeroGrad() { grad_.assign(grad_.size(), 0.0); }
+
+    /**
+     * @brief Number of nodes currently stored.
+     */
+    size_t size() const { return data_.size(); }
+
+    /**
+     * @brief Drops every non-leaf node, keeping parameters for the next iteration.
+     *
+     * Leaves are always created before derived nodes in the intended usage, so
+     * truncating at the first non-leaf keeps all parameters alive while the
+     * expression part of the graph is rebuilt each step without reallocating.
+     */
+    void resetGraph() {
+        size_t keep = 0;
+        while (keep < op_.size() && op_[keep] == Op::Leaf) keep++;
+        data_.resize(keep);
+        grad_.resize(keep);
+        op_.resize(keep);
+        parentA_.resize(keep);
+        parentB_.resize(keep);
+    }
+
+    /**
+     * @brief Backpropagates from the given root through the whole graph.
+     *
+     * Node ids are already a topological order (parents precede children), so
+     * a single reverse sweep from the root visits every node after all of its
+     * consumers. Dispatch is a direct switch on the opcode.
+     *
+     * @param root The node to differentiate.
+     */
+    void backward(ScalarId root) {
+        grad_[root] = 1.0;
+        for (ScalarId idx = root; idx >= 0; --idx) {
+            double g = grad_[idx];
+            if (g == 0.0)
+                continue;
+            ScalarId a = parentA_[idx], b = parentB_[idx];
+            switch (op_[idx]) {
+                case Op::Leaf:
+                    break;
+                case Op::Add:
+                    grad_[a] += g;
+                    grad_[b] += g;
+                    break;
+                case Op::Sub:
+                    grad_[a] += g;
+                    grad_[b] -= g;
+                    break;
+                case Op::Mul:
+                    grad_[a] += g * data_[b];
+                    grad_[b] += g * data_[a];
+                    break;
+                case Op::Div:
+                    grad_[a] += g / data_[b];
+                    grad_[b] -= g * data_[a] / (data_[b] * data_[b]);
+                    break;
+                case Op::Neg:
+                    grad_[a] -= g;
+                    break;
+                case Op::Exp:
+                    grad_[a] += g * data_[idx];
+                    break;
+                case Op::Pow:
+                    // The exponent rides in the second parent slot.
+                    grad_[a] += g * double(b) * std::pow(data_[a], b - 1);
+                    break;
+            }
+        }
+    }
+
+   private:
+    std::vector<double> data_, grad_;
+    std::vector<Op> op_;
+    std::vector<ScalarId> parentA_, parentB_;
+
+    ScalarId pushNode(Op op, double value, ScalarId a, ScalarId b) {
+        data_.push_back(value);
+        grad_.push_back(0.0);
+        op_.push_back(op);
+        parentA_.push_back(a);
+        parentB_.push_back(b);
+        return ScalarId(data_.size() - 1);
+    }
+};
+
+}  // namespace rash
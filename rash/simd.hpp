@@ -0,0 +1,1049 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Runtime ISA dispatch: on x86-64 GCC/Clang every SIMD kernel carries a
+// target("...") clone next to its scalar loop and picks between them through a
+// cached __builtin_cpu_supports check, so a single generic binary uses the
+// AVX paths on capable CPUs without being rebuilt with -mavx2.
+// (target_clones would be the terser spelling, but it only re-vectorizes plain
+// loops; these kernels are explicit intrinsics, so the manual gate is needed.)
+#if defined(__GNUC__) && defined(__x86_64__)
+#define RASH_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define RASH_NEON_F64 1
+#include <arm_neon.h>
+#endif
+
+namespace rash {
+
+#ifdef RASH_X86_DISPATCH
+/**
+ * @brief Cached runtime check for AVX support.
+ */
+inline bool cpuHasAvx() {
+    static const bool have = __builtin_cpu_supports("avx");
+    return have;
+}
+
+/**
+ * @brief Cached runtime check for AVX2 and FMA support.
+ */
+inline bool cpuHasAvx2Fma() {
+    static const bool have = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return have;
+}
+
+/**
+ * @brief Cached runtime check for AVX-512F support.
+ */
+inline bool cpuHasAvx512() {
+    static const bool have = __builtin_cpu_supports("avx512f");
+    return have;
+}
+#endif
+
+// Element-wise double kernels: eight lanes per iteration on AVX-512, four on
+// AVX, two on NEON, with a scalar tail. The widest supported tier is tried
+// first. All buffers must be 64-byte aligned (tensor storage is) and the
+// output may alias either input: every iteration loads both operands before
+// it stores.
+
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx512f"))) inline size_t vecAddF64Avx512(const double* a, const double* b, double* out,
+                                                                 size_t n) {
+    size_t idx = 0;
+    for (; idx + 8 <= n; idx += 8) {
+        _mm512_store_pd(out + idx, _mm512_add_pd(_mm512_load_pd(a + idx), _mm512_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t vecSubF64Avx512(const double* a, const double* b, double* out,
+                                                                 size_t n) {
+    size_t idx = 0;
+    for (; idx + 8 <= n; idx += 8) {
+        _mm512_store_pd(out + idx, _mm512_sub_pd(_mm512_load_pd(a + idx), _mm512_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t vecMulF64Avx512(const double* a, const double* b, double* out,
+                                                                 size_t n) {
+    size_t idx = 0;
+    for (; idx + 8 <= n; idx += 8) {
+        _mm512_store_pd(out + idx, _mm512_mul_pd(_mm512_load_pd(a + idx), _mm512_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t vecDivF64Avx512(const double* a, const double* b, double* out,
+                                                                 size_t n) {
+    size_t idx = 0;
+    for (; idx + 8 <= n; idx += 8) {
+        _mm512_store_pd(out + idx, _mm512_div_pd(_mm512_load_pd(a + idx), _mm512_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t vecFmaddF64Avx512(const double* a, const double* b, double* acc,
+                                                                   size_t n) {
+    size_t idx = 0;
+    for (; idx + 8 <= n; idx += 8) {
+        __m512d g = _mm512_load_pd(acc + idx);
+        _mm512_store_pd(acc + idx, _mm512_fmadd_pd(_mm512_load_pd(a + idx), _mm512_load_pd(b + idx), g));
+    }
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t vecFmaF64Avx512(const double* a, const double* b, const double* c,
+                                                                 double* out, size_t n) {
+    size_t idx = 0;
+    for (; idx + 8 <= n; idx += 8) {
+        _mm512_store_pd(out + idx,
+                        _mm512_fmadd_pd(_mm512_load_pd(a + idx), _mm512_load_pd(b + idx), _mm512_load_pd(c + idx)));
+    }
+    return idx;
+}
+#endif
+
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx"))) inline size_t vecAddF64Avx(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_add_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecSubF64Avx(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_sub_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecMulF64Avx(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_mul_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecDivF64Avx(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_div_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecAddScalarF64Avx(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_add_pd(_mm256_load_pd(a + idx), sv));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecSubScalarF64Avx(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_sub_pd(_mm256_load_pd(a + idx), sv));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecMulScalarF64Avx(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_mul_pd(_mm256_load_pd(a + idx), sv));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecDivScalarF64Avx(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_div_pd(_mm256_load_pd(a + idx), sv));
+    }
+    return idx;
+}
+#endif
+
+/**
+ * @brief Element-wise out[i] = a[i] + b[i] over same-length buffers.
+ */
+inline void vecAddF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecAddF64Avx512(a, b, out, n);
+    else if (cpuHasAvx())
+        idx = vecAddF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vaddq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] + b[idx];
+    }
+}
+
+/**
+ * @brief Element-wise out[i] = a[i] - b[i] over same-length buffers.
+ */
+inline void vecSubF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecSubF64Avx512(a, b, out, n);
+    else if (cpuHasAvx())
+        idx = vecSubF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vsubq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] - b[idx];
+    }
+}
+
+/**
+ * @brief Element-wise out[i] = a[i] * b[i] over same-length buffers.
+ */
+inline void vecMulF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecMulF64Avx512(a, b, out, n);
+    else if (cpuHasAvx())
+        idx = vecMulF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vmulq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] * b[idx];
+    }
+}
+
+/**
+ * @brief Element-wise out[i] = a[i] / b[i] over same-length buffers.
+ */
+inline void vecDivF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecDivF64Avx512(a, b, out, n);
+    else if (cpuHasAvx())
+        idx = vecDivF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vdivq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] / b[idx];
+    }
+}
+
+/**
+ * @brief Broadcast out[i] = a[i] + s.
+ */
+inline void vecAddScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecAddScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vaddq_f64(vld1q_f64(a + idx), sv));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] + s;
+    }
+}
+
+/**
+ * @brief Broadcast out[i] = a[i] - s.
+ */
+inline void vecSubScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecSubScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vsubq_f64(vld1q_f64(a + idx), sv));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] - s;
+    }
+}
+
+/**
+ * @brief Broadcast out[i] = a[i] * s.
+ */
+inline void vecMulScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecMulScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vmulq_f64(vld1q_f64(a + idx), sv));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] * s;
+    }
+}
+
+/**
+ * @brief Broadcast out[i] = a[i] / s.
+ */
+inline void vecDivScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecDivScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vdivq_f64(vld1q_f64(a + idx), sv));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] / s;
+    }
+}
+
+
+// Comparison kernels produce 0.0/1.0 masks without a per-element branch: the
+// hardware compare yields an all-ones/all-zero lane mask that is ANDed with
+// the bit pattern of 1.0, and the scalar tails use bool-to-double conversion,
+// which compilers lower to a branchless compare as well. On unpredictable
+// data this sidesteps the mispredict penalty of an if-per-element loop.
+
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx"))) inline size_t vecCmpGtF64Avx(const double* a, const double* b, double* out,
+                                                                size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx), _CMP_GT_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecCmpGtScalarF64Avx(const double* a, double s, double* out,
+                                                                      size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), sv, _CMP_GT_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecCmpGeF64Avx(const double* a, const double* b, double* out,
+                                                                size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx), _CMP_GE_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecCmpGeScalarF64Avx(const double* a, double s, double* out,
+                                                                      size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), sv, _CMP_GE_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecCmpLtF64Avx(const double* a, const double* b, double* out,
+                                                                size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx), _CMP_LT_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecCmpLtScalarF64Avx(const double* a, double s, double* out,
+                                                                      size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), sv, _CMP_LT_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecCmpLeF64Avx(const double* a, const double* b, double* out,
+                                                                size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx), _CMP_LE_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecCmpLeScalarF64Avx(const double* a, double s, double* out,
+                                                                      size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d m = _mm256_cmp_pd(_mm256_load_pd(a + idx), sv, _CMP_LE_OQ);
+        _mm256_store_pd(out + idx, _mm256_and_pd(m, one));
+    }
+    return idx;
+}
+#endif
+
+/**
+ * @brief Branchless greater-than mask: out[i] = double(a[i] > b[i]).
+ */
+inline void vecCmpGtF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpGtF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcgtq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx));
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] > b[idx]);
+    }
+}
+
+/**
+ * @brief Branchless greater-than mask against a scalar: out[i] = double(a[i] > s).
+ */
+inline void vecCmpGtScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpGtScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcgtq_f64(vld1q_f64(a + idx), sv);
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] > s);
+    }
+}
+
+/**
+ * @brief Branchless greater-or-equal mask: out[i] = double(a[i] >= b[i]).
+ */
+inline void vecCmpGeF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpGeF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcgeq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx));
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] >= b[idx]);
+    }
+}
+
+/**
+ * @brief Branchless greater-or-equal mask against a scalar: out[i] = double(a[i] >= s).
+ */
+inline void vecCmpGeScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpGeScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcgeq_f64(vld1q_f64(a + idx), sv);
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] >= s);
+    }
+}
+
+/**
+ * @brief Branchless less-than mask: out[i] = double(a[i] < b[i]).
+ */
+inline void vecCmpLtF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpLtF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcltq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx));
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] < b[idx]);
+    }
+}
+
+/**
+ * @brief Branchless less-than mask against a scalar: out[i] = double(a[i] < s).
+ */
+inline void vecCmpLtScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpLtScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcltq_f64(vld1q_f64(a + idx), sv);
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] < s);
+    }
+}
+
+/**
+ * @brief Branchless less-or-equal mask: out[i] = double(a[i] <= b[i]).
+ */
+inline void vecCmpLeF64(const double* a, const double* b, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpLeF64Avx(a, b, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcleq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx));
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] <= b[idx]);
+    }
+}
+
+/**
+ * @brief Branchless less-or-equal mask against a scalar: out[i] = double(a[i] <= s).
+ */
+inline void vecCmpLeScalarF64(const double* a, double s, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecCmpLeScalarF64Avx(a, s, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        uint64x2_t m = vcleq_f64(vld1q_f64(a + idx), sv);
+        vst1q_f64(out + idx, vreinterpretq_f64_u64(vandq_u64(m, one)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = double(a[idx] <= s);
+    }
+}
+
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx2,fma"))) inline size_t vecFmaddF64Avx(const double* a, const double* b, double* acc,
+                                                                 size_t n) {
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d g = _mm256_load_pd(acc + idx);
+        _mm256_store_pd(acc + idx, _mm256_fmadd_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx), g));
+    }
+    return idx;
+}
+
+__attribute__((target("avx2,fma"))) inline size_t vecFmaF64Avx(const double* a, const double* b, const double* c,
+                                                               double* out, size_t n) {
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx,
+                        _mm256_fmadd_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx), _mm256_load_pd(c + idx)));
+    }
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t vecFmaddScalarF64Avx512(const double* a, double s, double* acc,
+                                                                         size_t n) {
+    size_t idx = 0;
+    const __m512d sv = _mm512_set1_pd(s);
+    for (; idx + 8 <= n; idx += 8) {
+        __m512d g = _mm512_load_pd(acc + idx);
+        _mm512_store_pd(acc + idx, _mm512_fmadd_pd(_mm512_load_pd(a + idx), sv, g));
+    }
+    return idx;
+}
+
+__attribute__((target("avx2,fma"))) inline size_t vecFmaddScalarF64Avx(const double* a, double s, double* acc,
+                                                                       size_t n) {
+    size_t idx = 0;
+    const __m256d sv = _mm256_set1_pd(s);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d g = _mm256_load_pd(acc + idx);
+        _mm256_store_pd(acc + idx, _mm256_fmadd_pd(_mm256_load_pd(a + idx), sv, g));
+    }
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecDivAddF64Avx(const double* a, const double* b, double* acc, size_t n) {
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d q = _mm256_div_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx));
+        _mm256_store_pd(acc + idx, _mm256_add_pd(_mm256_load_pd(acc + idx), q));
+    }
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t vecSumF64Avx512(const double* a, size_t n, double& total) {
+    size_t idx = 0;
+    // Four independent accumulators: a single one serializes the loop on the
+    // 4-cycle FP add latency, leaving the add ports mostly idle.
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    __m512d acc2 = _mm512_setzero_pd();
+    __m512d acc3 = _mm512_setzero_pd();
+    for (; idx + 32 <= n; idx += 32) {
+        acc0 = _mm512_add_pd(acc0, _mm512_load_pd(a + idx));
+        acc1 = _mm512_add_pd(acc1, _mm512_load_pd(a + idx + 8));
+        acc2 = _mm512_add_pd(acc2, _mm512_load_pd(a + idx + 16));
+        acc3 = _mm512_add_pd(acc3, _mm512_load_pd(a + idx + 24));
+    }
+    for (; idx + 8 <= n; idx += 8) {
+        acc0 = _mm512_add_pd(acc0, _mm512_load_pd(a + idx));
+    }
+    acc0 = _mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3));
+    total = _mm512_reduce_add_pd(acc0);
+    return idx;
+}
+
+__attribute__((target("avx512f"))) inline size_t mseSumF64Avx512(const double* a, const double* b, size_t n,
+                                                                 double& total) {
+    size_t idx = 0;
+    __m512d acc = _mm512_setzero_pd();
+    for (; idx + 8 <= n; idx += 8) {
+        __m512d d = _mm512_sub_pd(_mm512_load_pd(a + idx), _mm512_load_pd(b + idx));
+        acc = _mm512_fmadd_pd(d, d, acc);
+    }
+    total = _mm512_reduce_add_pd(acc);
+    return idx;
+}
+
+__attribute__((target("avx2,fma"))) inline size_t mseSumF64Avx(const double* a, const double* b, size_t n,
+                                                               double& total) {
+    size_t idx = 0;
+    __m256d acc = _mm256_setzero_pd();
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d d = _mm256_sub_pd(_mm256_load_pd(a + idx), _mm256_load_pd(b + idx));
+        acc = _mm256_fmadd_pd(d, d, acc);
+    }
+    __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    total = _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+    return idx;
+}
+
+__attribute__((target("avx"))) inline size_t vecSumF64Avx(const double* a, size_t n, double& total) {
+    size_t idx = 0;
+    // Same 4-way accumulator interleave as the AVX-512 clone.
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd();
+    __m256d acc3 = _mm256_setzero_pd();
+    for (; idx + 16 <= n; idx += 16) {
+        acc0 = _mm256_add_pd(acc0, _mm256_load_pd(a + idx));
+        acc1 = _mm256_add_pd(acc1, _mm256_load_pd(a + idx + 4));
+        acc2 = _mm256_add_pd(acc2, _mm256_load_pd(a + idx + 8));
+        acc3 = _mm256_add_pd(acc3, _mm256_load_pd(a + idx + 12));
+    }
+    for (; idx + 4 <= n; idx += 4) {
+        acc0 = _mm256_add_pd(acc0, _mm256_load_pd(a + idx));
+    }
+    acc0 = _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3));
+    __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+    total = _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+    return idx;
+}
+#endif
+
+/**
+ * @brief Fused accumulate acc[i] += a[i] * b[i] - one pass instead of a
+ * multiply temporary followed by an add sweep.
+ */
+inline void vecFmaddF64(const double* a, const double* b, double* acc, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecFmaddF64Avx512(a, b, acc, n);
+    else if (cpuHasAvx2Fma())
+        idx = vecFmaddF64Avx(a, b, acc, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(acc + idx, vfmaq_f64(vld1q_f64(acc + idx), vld1q_f64(a + idx), vld1q_f64(b + idx)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        acc[idx] += a[idx] * b[idx];
+    }
+}
+
+/**
+ * @brief Fused out-of-place multiply-add out[i] = a[i] * b[i] + c[i].
+ *
+ * One streaming pass over three inputs instead of materializing a * b and
+ * adding c in a second sweep; the FMA also keeps one rounding per element.
+ */
+inline void vecFmaF64(const double* a, const double* b, const double* c, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecFmaF64Avx512(a, b, c, out, n);
+    else if (cpuHasAvx2Fma())
+        idx = vecFmaF64Avx(a, b, c, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vfmaq_f64(vld1q_f64(c + idx), vld1q_f64(a + idx), vld1q_f64(b + idx)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = a[idx] * b[idx] + c[idx];
+    }
+}
+
+/**
+ * @brief Fused accumulate acc[i] += a[i] * s against a broadcast scalar.
+ */
+inline void vecFmaddScalarF64(const double* a, double s, double* acc, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecFmaddScalarF64Avx512(a, s, acc, n);
+    else if (cpuHasAvx2Fma())
+        idx = vecFmaddScalarF64Avx(a, s, acc, n);
+#endif
+#ifdef RASH_NEON_F64
+    const float64x2_t sv = vdupq_n_f64(s);
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(acc + idx, vfmaq_f64(vld1q_f64(acc + idx), vld1q_f64(a + idx), sv));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        acc[idx] += a[idx] * s;
+    }
+}
+
+/**
+ * @brief Fused accumulate acc[i] += a[i] / b[i].
+ */
+inline void vecDivAddF64(const double* a, const double* b, double* acc, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecDivAddF64Avx(a, b, acc, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(acc + idx, vaddq_f64(vld1q_f64(acc + idx), vdivq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx))));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        acc[idx] += a[idx] / b[idx];
+    }
+}
+
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx"))) inline size_t vecAbsF64Avx(const double* a, double* out, size_t n) {
+    const __m256d signBit = _mm256_set1_pd(-0.0);
+    size_t idx = 0;
+    for (; idx + 4 <= n; idx += 4) {
+        _mm256_store_pd(out + idx, _mm256_andnot_pd(signBit, _mm256_load_pd(a + idx)));
+    }
+    return idx;
+}
+#endif
+
+/**
+ * @brief Element-wise absolute value: one andnot against the sign bit.
+ */
+inline void vecAbsF64(const double* a, double* out, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecAbsF64Avx(a, out, n);
+#endif
+#ifdef RASH_NEON_F64
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vabsq_f64(vld1q_f64(a + idx)));
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = std::fabs(a[idx]);
+    }
+}
+
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx"))) inline size_t vecFillF64Avx(double* out, double v, size_t n) {
+    const __m256d vv = _mm256_set1_pd(v);
+    size_t idx = 0;
+    if (n * sizeof(double) >= (size_t(1) << 21)) {
+        // Beyond L2-ish sizes, non-temporal stores skip the read-for-
+        // ownership and cache fill the buffer would otherwise evict with.
+        for (; idx + 4 <= n; idx += 4) {
+            _mm256_stream_pd(out + idx, vv);
+        }
+        _mm_sfence();
+    } else {
+        for (; idx + 4 <= n; idx += 4) {
+            _mm256_store_pd(out + idx, vv);
+        }
+    }
+    return idx;
+}
+#endif
+
+/**
+ * @brief Fills a buffer with one value; streams past the cache when large.
+ *
+ * The buffer must be 32-byte aligned (tensor storage is).
+ */
+inline void vecFillF64(double* out, double v, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = vecFillF64Avx(out, v, n);
+#endif
+#ifdef RASH_NEON_F64
+    const float64x2_t vv = vdupq_n_f64(v);
+    for (; idx + 2 <= n; idx += 2) {
+        vst1q_f64(out + idx, vv);
+    }
+#endif
+    for (; idx < n; ++idx) {
+        out[idx] = v;
+    }
+}
+
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx2,fma"))) inline void matmulSmallF64Avx2(const double* a, const double* b, double* out,
+                                                                   int m, int k, int n) {
+    // 4x4 register tile: four output rows share every B load, so B is
+    // streamed from cache once per row block instead of once per row.
+    int i = 0;
+    for (; i + 4 <= m; i += 4) {
+        int j = 0;
+        for (; j + 4 <= n; j += 4) {
+            __m256d c0 = _mm256_setzero_pd();
+            __m256d c1 = _mm256_setzero_pd();
+            __m256d c2 = _mm256_setzero_pd();
+            __m256d c3 = _mm256_setzero_pd();
+            for (int kk = 0; kk < k; ++kk) {
+                const __m256d bv = _mm256_loadu_pd(b + kk * n + j);
+                c0 = _mm256_fmadd_pd(_mm256_set1_pd(a[(i + 0) * k + kk]), bv, c0);
+                c1 = _mm256_fmadd_pd(_mm256_set1_pd(a[(i + 1) * k + kk]), bv, c1);
+                c2 = _mm256_fmadd_pd(_mm256_set1_pd(a[(i + 2) * k + kk]), bv, c2);
+                c3 = _mm256_fmadd_pd(_mm256_set1_pd(a[(i + 3) * k + kk]), bv, c3);
+            }
+            _mm256_storeu_pd(out + (i + 0) * n + j, c0);
+            _mm256_storeu_pd(out + (i + 1) * n + j, c1);
+            _mm256_storeu_pd(out + (i + 2) * n + j, c2);
+            _mm256_storeu_pd(out + (i + 3) * n + j, c3);
+        }
+        for (; j < n; ++j) {
+            for (int r = 0; r < 4; ++r) {
+                double sum = 0.0;
+                for (int kk = 0; kk < k; ++kk) {
+                    sum += a[(i + r) * k + kk] * b[kk * n + j];
+                }
+                out[(i + r) * n + j] = sum;
+            }
+        }
+    }
+    for (; i < m; ++i) {
+        double* outRow = out + i * n;
+        int j = 0;
+        for (; j + 4 <= n; j += 4) {
+            _mm256_storeu_pd(outRow + j, _mm256_setzero_pd());
+        }
+        for (; j < n; ++j) {
+            outRow[j] = 0.0;
+        }
+        for (int kk = 0; kk < k; ++kk) {
+            const __m256d av = _mm256_set1_pd(a[i * k + kk]);
+            const double* bRow = b + kk * n;
+            for (j = 0; j + 4 <= n; j += 4) {
+                _mm256_storeu_pd(outRow + j, _mm256_fmadd_pd(av, _mm256_loadu_pd(bRow + j), _mm256_loadu_pd(outRow + j)));
+            }
+            for (; j < n; ++j) {
+                outRow[j] += a[i * k + kk] * bRow[j];
+            }
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Single small matrix product out = a @ b with no BLAS dispatch.
+ *
+ * For tiny M/N/K the per-call overhead of cblas_dgemm (argument checking,
+ * kernel selection, packing setup) outweighs the arithmetic. The AVX2 clone
+ * accumulates a 4x4 register tile so each B load feeds four output rows,
+ * broadcasting one A element per row against contiguous B rows; leftover
+ * rows fall back to a single-row accumulator. Batch offsets are not
+ * cache-line aligned, hence the unaligned loads.
+ */
+inline void matmulSmallF64(const double* a, const double* b, double* out, int m, int k, int n) {
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx2Fma()) {
+        matmulSmallF64Avx2(a, b, out, m, k, n);
+        return;
+    }
+#endif
+    for (int i = 0; i < m; ++i) {
+        double* outRow = out + i * n;
+        for (int j = 0; j < n; ++j) {
+            outRow[j] = 0.0;
+        }
+        for (int kk = 0; kk < k; ++kk) {
+            double av = a[i * k + kk];
+            const double* bRow = b + kk * n;
+            for (int j = 0; j < n; ++j) {
+                outRow[j] += av * bRow[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sum of squared differences between two contiguous buffers.
+ *
+ * One streaming pass with an FMA accumulator instead of materializing the
+ * difference, squaring it into a second temporary and summing in a third
+ * sweep.
+ */
+inline double mseSumF64(const double* a, const double* b, size_t n) {
+    double total = 0.0;
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = mseSumF64Avx512(a, b, n, total);
+    else if (cpuHasAvx2Fma())
+        idx = mseSumF64Avx(a, b, n, total);
+#endif
+#ifdef RASH_NEON_F64
+    float64x2_t acc = vdupq_n_f64(0.0);
+    for (; idx + 2 <= n; idx += 2) {
+        float64x2_t d = vsubq_f64(vld1q_f64(a + idx), vld1q_f64(b + idx));
+        acc = vfmaq_f64(acc, d, d);
+    }
+    total += vaddvq_f64(acc);
+#endif
+    for (; idx < n; ++idx) {
+        double d = a[idx] - b[idx];
+        total += d * d;
+    }
+    return total;
+}
+
+/**
+ * @brief Horizontal sum of a contiguous buffer.
+ */
+inline double vecSumF64(const double* a, size_t n) {
+    double total = 0.0;
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = vecSumF64Avx512(a, n, total);
+    else if (cpuHasAvx())
+        idx = vecSumF64Avx(a, n, total);
+#endif
+#ifdef RASH_NEON_F64
+    float64x2_t acc = vdupq_n_f64(0.0);
+    for (; idx + 2 <= n; idx += 2) {
+        acc = vaddq_f64(acc, vld1q_f64(a + idx));
+    }
+    total += vaddvq_f64(acc);
+#endif
+    for (; idx < n; ++idx) {
+        total += a[idx];
+    }
+    return total;
+}
+
+}  // namespace rash
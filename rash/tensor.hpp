@@ -1,31 +1,245 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
-#include <functional>
-#include <iostream>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
-#include <queue>
+#include <ostream>
 #include <vector>
 
 #include "tensorMeta.hpp"
 
-const char* bool2String(bool val) { return val ? "true" : "false"; }
+inline const char* bool2String(bool val) { return val ? "true" : "false"; }
 
 namespace rash {
 
+/**
+ * @brief Builds a derived debug tag for an op result tensor.
+ *
+ * Every operator used to concatenate its operand tags eagerly, heap-allocating
+ * two strings per graph node even though the tags are only ever read when a
+ * tensor is printed. Tag composition is now opt-in: define RASH_DETAILED_TAGS
+ * to get the old descriptive tags, otherwise derived tensors carry an empty
+ * tag and the forward pass performs no string work at all.
+ */
+inline std::string composeTag(std::initializer_list<std::string_view> parts) {
+#ifdef RASH_DETAILED_TAGS
+    size_t total = 0;
+    for (auto& part : parts) total += part.size();
+    std::string tag;
+    tag.reserve(total);
+    for (auto& part : parts) tag += part;
+    return tag;
+#else
+    (void)parts;
+    return {};
+#endif
+}
+
+/**
+ * @brief Zeroes every gradient element whose forward activation was non-positive.
+ *
+ * Replays a bit-packed sign mask (one bit per element, recorded on forward by
+ * the ReLU-style kernels) over a gradient buffer.
+ *
+ * @param mask Bit mask recorded on forward.
+ * @param grad The gradient buffer, updated in place.
+ * @param n Number of elements.
+ */
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx"))) inline size_t reluBackwardKernelAvx(const uint64_t* mask, double* grad, size_t n) {
+    size_t idx = 0;
+    // Expand 4 mask bits at a time into full-width lane masks and AND them in.
+    alignas(32) static const uint64_t kLaneMask[16][4] = {
+        {0, 0, 0, 0},
+        {~0ULL, 0, 0, 0},
+        {0, ~0ULL, 0, 0},
+        {~0ULL, ~0ULL, 0, 0},
+        {0, 0, ~0ULL, 0},
+        {~0ULL, 0, ~0ULL, 0},
+        {0, ~0ULL, ~0ULL, 0},
+        {~0ULL, ~0ULL, ~0ULL, 0},
+        {0, 0, 0, ~0ULL},
+        {~0ULL, 0, 0, ~0ULL},
+        {0, ~0ULL, 0, ~0ULL},
+        {~0ULL, ~0ULL, 0, ~0ULL},
+        {0, 0, ~0ULL, ~0ULL},
+        {~0ULL, 0, ~0ULL, ~0ULL},
+        {0, ~0ULL, ~0ULL, ~0ULL},
+        {~0ULL, ~0ULL, ~0ULL, ~0ULL}};
+    for (; idx + 4 <= n; idx += 4) {
+        unsigned bits = (mask[idx >> 6] >> (idx & 63)) & 0xF;
+        __m256d lanes = _mm256_load_pd(reinterpret_cast<const double*>(kLaneMask[bits]));
+        _mm256_store_pd(grad + idx, _mm256_and_pd(_mm256_load_pd(grad + idx), lanes));
+    }
+    return idx;
+}
+#endif
+
+inline void reluBackwardKernel(const uint64_t* mask, double* grad, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx())
+        idx = reluBackwardKernelAvx(mask, grad, n);
+#endif
+    for (; idx < n; ++idx) {
+        if (!((mask[idx >> 6] >> (idx & 63)) & 1)) {
+            grad[idx] = 0.0;
+        }
+    }
+}
+
+class TensorImpl;
+
+/**
+ * @brief Inline-storage list of a node's parents.
+ *
+ * Graph nodes have at most three parents (LinearReLU), yet std::vector paid a
+ * heap allocation per op for that handful of pointers. ParentList keeps the
+ * edges in the node itself with a small count, so wiring a unary or binary op
+ * performs no allocation at all. The interface mirrors the slice of
+ * std::vector the engine actually uses.
+ */
+class ParentList {
+    static constexpr size_t kMaxParents = 3;
+    std::array<std::shared_ptr<TensorImpl>, kMaxParents> nodes_;
+    uint8_t count_ = 0;
+
+   public:
+    /**
+     * @brief Inline capacity; the widest op (LinearReLU) has three parents.
+     */
+    static constexpr size_t capacity() { return kMaxParents; }
+
+    void reserve(size_t n) { assert(n <= kMaxParents && "ParentList capacity exceeded!"); }
+
+    void emplace_back(const std::shared_ptr<TensorImpl>& node) {
+        assert(count_ < kMaxParents && "ParentList capacity exceeded!");
+        nodes_[count_++] = node;
+    }
+
+    size_t size() const { return count_; }
+
+    const std::shared_ptr<TensorImpl>& operator[](size_t idx) const { return nodes_[idx]; }
+
+    void clear() {
+        for (size_t idx = 0; idx < count_; ++idx) {
+            nodes_[idx].reset();
+        }
+        count_ = 0;
+    }
+};
+
+/**
+ * @brief Opcode identifying which backward formula a graph node uses.
+ *
+ * Backward dispatch used to be a std::function closure per node - a heap
+ * allocation plus a type-erased indirect call per edge. Every op the library
+ * offers has a fixed gradient formula, so nodes now carry this opcode and the
+ * engine switches on it directly.
+ */
+enum class BackwardOp : uint8_t {
+    None,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Exp,
+    Transpose,
+    MatMul,
+    MatMulNT,
+    Pow,
+    ReLU,
+    LinearReLU,
+    Sigmoid,
+    Softmax,
+    AddScalar,
+    MulScalar,
+    MseLoss
+};
+
+/**
+ * @brief Human-readable name of a backward opcode.
+ *
+ * Lets printed tensors stay identifiable when detailed tags are disabled and
+ * derived nodes carry an empty tag: the opcode that produced the node is
+ * always available, so the label costs nothing on the forward path.
+ */
+inline const char* backwardOpName(BackwardOp op) {
+    switch (op) {
+        case BackwardOp::None:
+            return "leaf";
+        case BackwardOp::Add:
+            return "add";
+        case BackwardOp::Sub:
+            return "sub";
+        case BackwardOp::Mul:
+            return "mul";
+        case BackwardOp::Div:
+            return "div";
+        case BackwardOp::Neg:
+            return "neg";
+        case BackwardOp::Exp:
+            return "exp";
+        case BackwardOp::Transpose:
+            return "transpose";
+        case BackwardOp::MatMul:
+            return "matmul";
+        case BackwardOp::MatMulNT:
+            return "matmulNT";
+        case BackwardOp::Pow:
+            return "pow";
+        case BackwardOp::ReLU:
+            return "relu";
+        case BackwardOp::LinearReLU:
+            return "linearReLU";
+        case BackwardOp::Sigmoid:
+            return "sigmoid";
+        case BackwardOp::Softmax:
+            return "softmax";
+        case BackwardOp::AddScalar:
+            return "addScalar";
+        case BackwardOp::MulScalar:
+            return "mulScalar";
+        case BackwardOp::MseLoss:
+            return "mseLoss";
+    }
+    return "unknown";
+}
+
 /**
  * @brief TensorImpl class represents the implementation details of a tensor.
  *
  * This class is responsible for managing the tensor's data, gradients, and
  * backward functions. It also handles the computation graph for automatic
  * differentiation.
+ *
+ * Graph edges are owning shared_ptrs held inline in a ParentList (no per-op
+ * vector allocation, no weak_ptr lock per traversal step): the graph is
+ * acyclic, so output-to-input ownership cannot leak, and backward() walks raw
+ * pointers without touching a refcount. After the sweep the edges are
+ * released in inputs-first order, which gives the same forward-backward-
+ * discard lifetime an index arena would provide while keeping Tensor's value
+ * semantics - nodes a user still holds simply survive the discard.
  */
 class TensorImpl {
    public:
     int id;
-    std::map<int, bool> gradVisited;
-    std::function<void(TensorMeta)> _backward;
-    std::vector<std::weak_ptr<TensorImpl>> prev;
+    BackwardOp bwdOp = BackwardOp::None;
+    int powExp = 0;
+    // Forward-state for scalar ops: d(x*s)/dx = s (and 1/s for division).
+    double scalarOperand = 0.0;
+    uint32_t visitEpoch = 0;
+    uint32_t bwdLevel = 0;
+    // Spinlock over this node's grad, taken by concurrent consumers when the
+    // level-parallel backward is active; a byte of padding otherwise.
+    std::atomic_flag gradLock = ATOMIC_FLAG_INIT;
+    std::vector<uint64_t> bitMask;
+    ParentList prev;
     bool requiresGrad;
     TensorMeta data_, grad;
     std::string tag;
@@ -38,9 +252,20 @@ class TensorImpl {
      * @param tensorTag A tag for identifying the tensor.
      */
     TensorImpl(TensorMeta data, bool requiresGrad, std::string tensorTag)
-        : data_(std::move(data)), requiresGrad(requiresGrad), tag(tensorTag) {
-        grad = TensorMeta(data_.shape());
-        grad.updateAll(0.0);
+        : data_(std::move(data)), requiresGrad(requiresGrad), tag(std::move(tensorTag)) {}
+
+    /**
+     * @brief Returns the gradient buffer, allocating it zeroed on first use.
+     *
+     * Construction leaves grad empty: nodes that backward never reaches
+     * (requiresGrad=false leaves, branches outside the differentiated graph)
+     * skip the data_-sized allocation entirely instead of paying for it on
+     * every forward op.
+     */
+    TensorMeta& fetchGrad() {
+        if (grad.rawData.empty())
+            grad = TensorMeta::zerosLike(data_);
+        return grad;
     }
 
     /**
@@ -48,53 +273,366 @@ class TensorImpl {
      */
     ~TensorImpl() = default;
 
+    /**
+     * @brief Applies this node's backward formula, pushing gradients to its parents.
+     *
+     * Dispatch is a direct switch on the opcode; each case reads this node's
+     * accumulated gradient and the parent data it needs. Nodes produced by ops
+     * that cache forward state (ReLU mask bits, the integer exponent of pow)
+     * read it from the node itself.
+     */
+    void fireBackward() {
+        switch (bwdOp) {
+            case BackwardOp::None:
+                break;
+            case BackwardOp::Add:
+                if (prev[0]->requiresGrad)
+                    prev[0]->accumulateGrad(grad);
+                if (prev[1]->requiresGrad)
+                    prev[1]->accumulateGrad(grad);
+                break;
+            case BackwardOp::Sub:
+                if (prev[0]->requiresGrad)
+                    prev[0]->accumulateGrad(grad);
+                if (prev[1]->requiresGrad)
+                    prev[1]->accumulateGrad(grad, true);
+                break;
+            case BackwardOp::Mul: {
+                // Same-shape edges accumulate via one FMA sweep, no temporary.
+                bool sameShape =
+                    prev[0]->data_.shape() == data_.shape() && prev[1]->data_.shape() == data_.shape();
+                if (prev[0]->requiresGrad) {
+                    if (sameShape)
+                        prev[0]->fetchGrad().axpy(grad, prev[1]->data_);
+                    else
+                        // Multiply and reduce in one sweep, no out-shaped temporary.
+                        TensorMeta::reduceProductIntoShape(grad, prev[1]->data_, prev[0]->fetchGrad(), false);
+                }
+                if (prev[1]->requiresGrad) {
+                    if (sameShape)
+                        prev[1]->fetchGrad().axpy(grad, prev[0]->data_);
+                    else
+                        TensorMeta::reduceProductIntoShape(grad, prev[0]->data_, prev[1]->fetchGrad(), false);
+                }
+                break;
+            }
+            case BackwardOp::Div: {
+                TensorMeta& dividend = prev[0]->data_;
+                TensorMeta& divisor = prev[1]->data_;
+                bool sameShape = dividend.shape() == divisor.shape() && divisor.shape() == grad.shape();
+                if (prev[0]->requiresGrad) {
+                    if (sameShape)
+                        vecDivAddF64(grad.rawData.data(), divisor.rawData.data(),
+                                     prev[0]->fetchGrad().rawData.data(), grad.rawData.size());
+                    else
+                        prev[0]->accumulateGrad(grad / divisor);
+                }
+                if (prev[1]->requiresGrad) {
+                    if (sameShape) {
+                        // One fused FNMADD sweep straight into the accumulator.
+                        divGradKernel(grad.rawData.data(), dividend.rawData.data(), divisor.rawData.data(),
+                                      prev[1]->fetchGrad().rawData.data(), grad.rawData.size());
+                    } else {
+                        prev[1]->accumulateGrad(grad * (dividend / (divisor * divisor)), true);
+                    }
+                }
+                break;
+            }
+            case BackwardOp::Neg:
+                if (prev[0]->requiresGrad)
+                    prev[0]->accumulateGrad(grad, true);
+                break;
+            case BackwardOp::AddScalar:
+                // The scalar operand is a constant; the gradient passes through.
+                if (prev[0]->requiresGrad)
+                    prev[0]->accumulateGrad(grad);
+                break;
+            case BackwardOp::MulScalar:
+                // Elementwise unary op, so shapes always match: one FMA sweep.
+                if (prev[0]->requiresGrad)
+                    vecFmaddScalarF64(grad.rawData.data(), scalarOperand, prev[0]->fetchGrad().rawData.data(),
+                                      grad.rawData.size());
+                break;
+            case BackwardOp::Exp:
+                // The node's own output is exactly exp(x), which is the local derivative;
+                // elementwise unary, so shapes always match and the FMA path applies.
+                if (prev[0]->requiresGrad)
+                    prev[0]->fetchGrad().axpy(grad, data_);
+                break;
+            case BackwardOp::MseLoss: {
+                // d/da sum((a-b)^2) = 2(a-b) * g; g is the incoming scalar.
+                const double g = 2.0 * grad.rawData[0];
+                TensorMeta diff = prev[0]->data_ - prev[1]->data_;
+                if (prev[0]->requiresGrad)
+                    vecFmaddScalarF64(diff.rawData.data(), g, prev[0]->fetchGrad().rawData.data(),
+                                      diff.rawData.size());
+                if (prev[1]->requiresGrad)
+                    vecFmaddScalarF64(diff.rawData.data(), -g, prev[1]->fetchGrad().rawData.data(),
+                                      diff.rawData.size());
+                break;
+            }
+            case BackwardOp::Sigmoid:
+                // d/dx sigmoid(x) = y * (1 - y), recovered from the node's own output.
+                if (prev[0]->requiresGrad) {
+                    TensorMeta scaled = grad;
+                    const AlignedVector& y = data_.rawData;
+                    for (size_t idx = 0; idx < scaled.rawData.size(); ++idx) {
+                        scaled.rawData[idx] *= y[idx] * (1.0 - y[idx]);
+                    }
+                    prev[0]->accumulateGrad(scaled);
+                }
+                break;
+            case BackwardOp::Softmax:
+                // Per row: dx_i = y_i * (g_i - sum_j g_j * y_j).
+                if (prev[0]->requiresGrad) {
+                    TensorMeta scaled = grad;
+                    const AlignedVector& y = data_.rawData;
+                    size_t rowLen = size_t(data_.shape().back());
+                    for (size_t base = 0; base < scaled.rawData.size(); base += rowLen) {
+                        double dot = 0.0;
+                        for (size_t idx = 0; idx < rowLen; ++idx) {
+                            dot += scaled.rawData[base + idx] * y[base + idx];
+                        }
+                        for (size_t idx = 0; idx < rowLen; ++idx) {
+                            scaled.rawData[base + idx] = y[base + idx] * (scaled.rawData[base + idx] - dot);
+                        }
+                    }
+                    prev[0]->accumulateGrad(scaled);
+                }
+                break;
+            case BackwardOp::Transpose:
+                if (prev[0]->requiresGrad)
+                    prev[0]->accumulateGrad(grad.T());
+                break;
+            case BackwardOp::MatMul:
+                if (prev[0]->data_.ndim() == 2 && prev[1]->data_.ndim() == 2) {
+                    // 2-D fast path: GEMM transpose flags, no materialized copies.
+                    if (prev[0]->requiresGrad)
+                        prev[0]->accumulateGrad(TensorMeta::matmulTrans(grad, prev[1]->data_, false, true));
+                    if (prev[1]->requiresGrad)
+                        prev[1]->accumulateGrad(TensorMeta::matmulTrans(prev[0]->data_, grad, true, false));
+                } else {
+                    if (prev[0]->requiresGrad)
+                        prev[0]->accumulateGrad(TensorMeta::matmul(grad, prev[1]->data_.transpose()));
+                    if (prev[1]->requiresGrad)
+                        prev[1]->accumulateGrad(TensorMeta::matmul(prev[0]->data_.transpose(), grad));
+                }
+                break;
+            case BackwardOp::MatMulNT:
+                // C = A . B^T, so dA = dC . B and dB = dC^T . A.
+                if (prev[0]->requiresGrad)
+                    prev[0]->accumulateGrad(TensorMeta::matmulTrans(grad, prev[1]->data_, false, false));
+                if (prev[1]->requiresGrad)
+                    prev[1]->accumulateGrad(TensorMeta::matmulTrans(grad, prev[0]->data_, true, false));
+                break;
+            case BackwardOp::Pow:
+                if (prev[0]->requiresGrad) {
+                    if (powExp >= 1) {
+                        // One fused sweep; the integer power unrolls to multiplies.
+                        powGradKernel(grad.rawData.data(), prev[0]->data_.rawData.data(),
+                                      prev[0]->fetchGrad().rawData.data(), grad.rawData.size(), powExp);
+                    } else {
+                        TensorMeta deriv = TensorMeta::pow(prev[0]->data_, powExp - 1) * double(powExp);
+                        prev[0]->fetchGrad().axpy(deriv, grad);
+                    }
+                }
+                break;
+            case BackwardOp::ReLU:
+                if (prev[0]->requiresGrad) {
+                    TensorMeta masked = grad;
+                    reluBackwardKernel(bitMask.data(), masked.rawData.data(), masked.rawData.size());
+                    prev[0]->accumulateGrad(masked);
+                }
+                break;
+            case BackwardOp::LinearReLU: {
+                // One masked gradient feeds the input, weight and bias updates.
+                TensorMeta masked = grad;
+                reluBackwardKernel(bitMask.data(), masked.rawData.data(), masked.rawData.size());
+                if (prev[0]->data_.ndim() == 2) {
+                    if (prev[0]->requiresGrad)
+                        prev[0]->accumulateGrad(TensorMeta::matmulTrans(masked, prev[1]->data_, false, true));
+                    if (prev[1]->requiresGrad)
+                        prev[1]->accumulateGrad(TensorMeta::matmulTrans(prev[0]->data_, masked, true, false));
+                } else {
+                    if (prev[0]->requiresGrad)
+                        prev[0]->accumulateGrad(TensorMeta::matmul(masked, prev[1]->data_.transpose()));
+                    if (prev[1]->requiresGrad)
+                        prev[1]->accumulateGrad(TensorMeta::matmul(prev[0]->data_.transpose(), masked));
+                }
+                if (prev[2]->requiresGrad)
+                    prev[2]->accumulateGrad(masked);
+                break;
+            }
+        }
+    }
+
     /**
      * @brief Performs backpropagation through the computation graph.
+     *
+     * Builds a post-order topological ordering of the graph with an explicit
+     * stack, then fires each node's backward formula exactly once in reverse
+     * topological order. Every node therefore sees its gradient fully
+     * accumulated from all of its consumers before it propagates further, and
+     * deep chains cannot overflow the call stack. Visit tracking is a per-node
+     * epoch stamp compared against a counter bumped once per backward() call:
+     * an O(1) field check with no hash set to allocate, rehash or tear down.
+     * Afterwards the graph edges are released so intermediate nodes can be
+     * reclaimed.
      */
     void backward() {
-        // Return if already calculated the gradients
-        if (gradVisited[id]) {
-            return;
+        // Atomic so two threads running backward on disjoint graphs still
+        // draw distinct epochs; within one graph the walk itself is serial.
+        static std::atomic<uint32_t> EPOCH{0};
+        const uint32_t epoch = EPOCH.fetch_add(1, std::memory_order_relaxed) + 1;
+        // Scratch reused across calls (backward never nests): a training loop
+        // walks the same-sized graph every step, so after the first call
+        // neither vector allocates again.
+        thread_local std::vector<TensorImpl*> topo;
+        thread_local std::vector<std::pair<TensorImpl*, size_t>> stack;
+        topo.clear();
+        stack.clear();
+
+        visitEpoch = epoch;
+        bwdLevel = 0;
+        stack.push_back({this, 0});
+        while (!stack.empty()) {
+            auto& [node, childIdx] = stack.back();
+            if (childIdx < node->prev.size()) {
+                TensorImpl* p = node->prev[childIdx++].get();
+                // requiresGrad propagates as the OR of the parents' flags at
+                // construction, so a false here means no leaf under p needs a
+                // gradient - the whole subtree can be pruned from the walk.
+                if (p->requiresGrad && p->visitEpoch != epoch) {
+                    p->visitEpoch = epoch;
+                    p->bwdLevel = 0;
+                    stack.push_back({p, 0});
+                }
+            } else {
+                topo.push_back(node);
+                stack.pop_back();
+            }
         }
 
-        // Mark gradients calculated
-        gradVisited[id] = true;
+#ifdef _OPENMP
+        if (parallelBackwardThreads() > 1) {
+            fireBackwardParallel(topo);
+        } else
+#endif
+        {
+            // Post-order places inputs before their consumers, so sweep in reverse.
+            for (auto it = topo.rbegin(); it != topo.rend(); ++it) {
+                TensorImpl* node = *it;
+                if (node->requiresGrad) {
+                    node->fireBackward();
+                }
+            }
+        }
 
-        // Return if no backward function found!
-        if (!(requiresGrad && _backward)) {
-            return;
+        // Release the graph. Walking in topo (inputs-first) order guarantees a
+        // node is never touched after a consumer's edge drop destroyed it.
+        for (TensorImpl* node : topo) {
+            node->bwdOp = BackwardOp::None;
+            node->prev.clear();
         }
+    }
 
-        // Perform gradient update
-        _backward(grad);
-        _backward = nullptr;
+#ifdef _OPENMP
+    /**
+     * @brief Worker count for the level-parallel backward sweep.
+     *
+     * Read once from RASH_NUM_THREADS; unset or <=1 keeps the sequential
+     * sweep, so parallelism is strictly opt-in even in OpenMP builds.
+     */
+    static int parallelBackwardThreads() { return configuredThreads(); }
 
-        // Backtrack to previous linked tensors
-        for (auto& weak_ptr : prev) {
-            if (auto p = weak_ptr.lock())
-                p->backward();
+    /**
+     * @brief Fires the backward sweep level by level across threads.
+     *
+     * A node's level is one past the deepest of its consumers, so every node
+     * in a level has all of its incoming gradient accumulated before the
+     * level starts and nodes within a level never read each other's grad.
+     * They can still share a parent (e.g. a weight used twice), so each
+     * firing takes the parents' spinlocks in address order first; with at
+     * most three parents per node the locks are cheap and deadlock-free.
+     */
+    void fireBackwardParallel(const std::vector<TensorImpl*>& topo) {
+        uint32_t maxLevel = 0;
+        for (auto it = topo.rbegin(); it != topo.rend(); ++it) {
+            TensorImpl* node = *it;
+            for (size_t idx = 0; idx < node->prev.size(); ++idx) {
+                TensorImpl* p = node->prev[idx].get();
+                p->bwdLevel = std::max(p->bwdLevel, node->bwdLevel + 1);
+            }
+            maxLevel = std::max(maxLevel, node->bwdLevel);
+        }
+        std::vector<std::vector<TensorImpl*>> levels(maxLevel + 1);
+        for (auto it = topo.rbegin(); it != topo.rend(); ++it) {
+            if ((*it)->requiresGrad) {
+                levels[(*it)->bwdLevel].push_back(*it);
+            }
+        }
+
+        const int numThreads = parallelBackwardThreads();
+        for (auto& level : levels) {
+            if (level.size() < 2) {
+                for (TensorImpl* node : level) {
+                    node->fireBackward();
+                }
+                continue;
+            }
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic)
+            for (size_t idx = 0; idx < level.size(); ++idx) {
+                TensorImpl* node = level[idx];
+                std::array<TensorImpl*, ParentList::capacity()> locks;
+                size_t lockCount = 0;
+                for (size_t parent = 0; parent < node->prev.size(); ++parent) {
+                    locks[lockCount++] = node->prev[parent].get();
+                }
+                std::sort(locks.begin(), locks.begin() + lockCount);
+                lockCount = std::unique(locks.begin(), locks.begin() + lockCount) - locks.begin();
+                for (size_t lock = 0; lock < lockCount; ++lock) {
+                    while (locks[lock]->gradLock.test_and_set(std::memory_order_acquire)) {
+                    }
+                }
+                node->fireBackward();
+                for (size_t lock = lockCount; lock-- > 0;) {
+                    locks[lock]->gradLock.clear(std::memory_order_release);
+                }
+            }
         }
     }
+#endif
 
     /**
      * @brief Resets gradients to zero.
      */
-    void zeroGrad() { grad.updateAll(0.0); }
+    void zeroGrad() { grad.zeroFill(); }
 
     /**
      * @brief Accumulates gradients, handling broadcasting where necessary.
      *
      * @param incGrad Incoming gradient to be accumulated.
+     * @param negate If true the gradient is subtracted instead, folding the
+     * sign flip into the accumulation rather than materializing -incGrad
+     * through a broadcast pass first.
      */
-    void accumulateGrad(TensorMeta incGrad) {
-        TensorMeta out = incGrad;
-        auto [addedDims, bcDims] = TensorMeta::fetchBroadcastedAxes(grad, out);
-        if (bcDims.size())
-            out = out.sum(bcDims);
-        if (addedDims.size())
-            out = out.sum(addedDims, true);
+    void accumulateGrad(const TensorMeta& incGrad, bool negate = false) {
+        TensorMeta& g = fetchGrad();
+
+        // Exact-shape edges (every non-broadcasting op) accumulate straight
+        // from the caller's buffer; the O(rank) compare skips the full
+        // broadcast-axis analysis they would otherwise pay for nothing.
+        if (g.shape() == incGrad.shape()) {
+            if (negate)
+                g -= incGrad;
+            else
+                g += incGrad;
+            return;
+        }
 
-        grad += out;
+        // Broadcast edges reduce straight into the accumulator: one sweep
+        // over the incoming gradient, no temporary.
+        TensorMeta::reduceIntoShape(incGrad, g, negate);
     }
 
     /**
@@ -102,17 +640,34 @@ class TensorImpl {
      *
      * @param updGrad The new gradient value.
      */
-    void updateGrad(TensorMeta updGrad) { grad = updGrad; }
+    void updateGrad(TensorMeta updGrad) { grad = std::move(updGrad); }
 
     /**
      * @brief Updates the data with a new value.
      *
      * @param updData The new data value.
      */
-    void updateData(TensorMeta updData) { data_ = updData; }
+    void updateData(TensorMeta updData) { data_ = std::move(updData); }
 };
 
-int TENSOR_ID = 0;
+// C++17 inline variable: one counter across all TUs instead of an ODR
+// violation, and atomic so concurrent Tensor construction stays race-free.
+inline std::atomic<int> TENSOR_ID{0};
+
+/**
+ * @brief Wires a result node to its parent nodes.
+ *
+ * Assigning prev from a braced list routes every edge through an
+ * initializer_list copy - two atomic refcount bumps per parent plus the
+ * matching releases. Reserving and emplacing directly keeps it to a single
+ * increment per edge.
+ */
+template <typename... Nodes>
+inline void linkParents(const std::shared_ptr<TensorImpl>& out, const Nodes&... parents) {
+    static_assert(sizeof...(parents) <= ParentList::capacity(),
+                  "Op arity exceeds the inline parent storage; widen ParentList.");
+    (out->prev.emplace_back(parents), ...);
+}
 
 /**
  * @brief General Tensor Class
@@ -125,7 +680,7 @@ class Tensor {
      * @brief Constructs a Tensor with specified data.
      */
     Tensor(TensorMeta data, bool requiresGrad, std::string tag)
-        : impl(std::make_shared<TensorImpl>(data, requiresGrad, tag)) {
+        : impl(std::make_shared<TensorImpl>(std::move(data), requiresGrad, std::move(tag))) {
         registerTensor();
     }
 
@@ -133,7 +688,7 @@ class Tensor {
      * @brief Constructs a scalar Tensor.
      */
     Tensor(double data, bool requiresGrad, std::string tag)
-        : impl(std::make_shared<TensorImpl>(TensorMeta(data), requiresGrad, tag)) {
+        : impl(std::make_shared<TensorImpl>(TensorMeta(data), requiresGrad, std::move(tag))) {
         registerTensor();
     };
 
@@ -141,27 +696,23 @@ class Tensor {
      * @brief Constructs a Tensor from a vector.
      */
     Tensor(std::vector<double> data, std::vector<int> shape, bool requiresGrad, std::string tag)
-        : impl(std::make_shared<TensorImpl>(TensorMeta(data, shape), requiresGrad, tag)) {
+        : impl(std::make_shared<TensorImpl>(TensorMeta(std::move(data), std::move(shape)), requiresGrad,
+                                            std::move(tag))) {
         registerTensor();
     }
 
     /**
      * @brief Destructor for the Tensor class.
      */
-    ~Tensor() { deRegisterTensor(); }
+    ~Tensor() = default;
 
     /**
-     * @brief Registers a tensor in the global storage.
-     */
-    void registerTensor() {
-        // globalTensorStorage[++TENSOR_ID] = impl;
-        impl->id = ++TENSOR_ID;
-    }
-
-    /**
-     * Removes a tensor from memory
+     * @brief Assigns the tensor its global id.
+     *
+     * Construction and destruction stay free of any I/O or global registry
+     * traffic; the only shared state touched is the id counter.
      */
-    void deRegisterTensor() {}
+    void registerTensor() { impl->id = TENSOR_ID.fetch_add(1, std::memory_order_relaxed) + 1; }
 
     /**
      * @brief Overloads the output stream operator for printing tensors.
@@ -170,8 +721,12 @@ class Tensor {
         os << "Tensor(";
         os << tensor.impl->data_ << ", requires_grad=" << bool2String(tensor.impl->requiresGrad) << ", ";
         if (tensor.impl->requiresGrad)
-            os << "Grad=" << tensor.impl->grad << ", ";
-        os << "Tag=" << tensor.impl->tag;
+            os << "Grad=" << tensor.impl->fetchGrad() << ", ";
+        os << "Tag=";
+        if (!tensor.impl->tag.empty())
+            os << tensor.impl->tag;
+        else
+            os << backwardOpName(tensor.impl->bwdOp);
         os << ")  ";
         return os;
     }
@@ -185,18 +740,10 @@ class Tensor {
      * @brief Adds two tensors.
      */
     Tensor operator+(const Tensor& other) {
-        std::string newTag = "(" + this->impl->tag + "+" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", this->impl->tag, "+", other.impl->tag, ")"});
         Tensor out(this->impl->data_ + other.impl->data_, this->impl->requiresGrad || other.impl->requiresGrad, newTag);
-        out.impl->prev = {impl, other.impl};
-        out.impl->_backward = [out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-            auto p1 = out_impl->prev[1].lock();
-
-            if (p0->requiresGrad)
-                p0->accumulateGrad(incGrad);
-            if (p1->requiresGrad)
-                p1->accumulateGrad(incGrad);
-        };
+        linkParents(out.impl, impl, other.impl);
+        out.impl->bwdOp = BackwardOp::Add;
 
         return out;
     }
@@ -205,15 +752,10 @@ class Tensor {
      * @brief Negates a tensor.
      */
     Tensor operator-() {
-        std::string newTag = "(-" + impl->tag + ")";
+        std::string newTag = composeTag({"(-", impl->tag, ")"});
         Tensor out(-impl->data_, impl->requiresGrad, newTag);
-        out.impl->prev = {impl};
-        out.impl->_backward = [out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-
-            if (p0->requiresGrad)
-                p0->accumulateGrad(-incGrad);
-        };
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::Neg;
 
         return out;
     }
@@ -222,19 +764,11 @@ class Tensor {
      * @brief Substracts two tensors.
      */
     Tensor operator-(const Tensor& other) {
-        std::string newTag = "(" + this->impl->tag + "-" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", this->impl->tag, "-", other.impl->tag, ")"});
         Tensor out(this->impl->data_ - other.impl->data_, this->impl->requiresGrad || other.impl->requiresGrad, newTag);
 
-        out.impl->prev = {impl, other.impl};
-        out.impl->_backward = [out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-            auto p1 = out_impl->prev[1].lock();
-
-            if (p0->requiresGrad)
-                p0->accumulateGrad(incGrad);
-            if (p1->requiresGrad)
-                p1->accumulateGrad(-incGrad);
-        };
+        linkParents(out.impl, impl, other.impl);
+        out.impl->bwdOp = BackwardOp::Sub;
 
         return out;
     }
@@ -243,19 +777,85 @@ class Tensor {
      * @brief Multiplies two tensors.
      */
     Tensor operator*(const Tensor& other) {
-        std::string newTag = "(" + this->impl->tag + "*" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", this->impl->tag, "*", other.impl->tag, ")"});
         Tensor out(this->impl->data_ * other.impl->data_, this->impl->requiresGrad || other.impl->requiresGrad, newTag);
 
-        out.impl->prev = {impl, other.impl};
-        out.impl->_backward = [out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-            auto p1 = out_impl->prev[1].lock();
+        linkParents(out.impl, impl, other.impl);
+        out.impl->bwdOp = BackwardOp::Mul;
+
+        return out;
+    }
 
-            if (p0->requiresGrad)
-                p0->accumulateGrad(incGrad * p1->data_);
-            if (p1->requiresGrad)
-                p1->accumulateGrad(incGrad * p0->data_);
-        };
+    /**
+     * @brief Adds a scalar constant to the tensor.
+     *
+     * A plain scalar (learning rate, loss scale) no longer needs wrapping in
+     * a scalar-shaped Tensor: the op skips the broadcast machinery on both
+     * passes and the constant contributes no gradient of its own.
+     */
+    Tensor operator+(double other) {
+#ifdef RASH_DETAILED_TAGS
+        std::string scalarStr = std::to_string(other);
+#else
+        std::string scalarStr;
+#endif
+        std::string newTag = composeTag({"(", impl->tag, "+", scalarStr, ")"});
+        Tensor out(impl->data_ + other, impl->requiresGrad, newTag);
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::AddScalar;
+
+        return out;
+    }
+
+    /**
+     * @brief Subtracts a scalar constant from the tensor.
+     */
+    Tensor operator-(double other) {
+#ifdef RASH_DETAILED_TAGS
+        std::string scalarStr = std::to_string(other);
+#else
+        std::string scalarStr;
+#endif
+        std::string newTag = composeTag({"(", impl->tag, "-", scalarStr, ")"});
+        Tensor out(impl->data_ - other, impl->requiresGrad, newTag);
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::AddScalar;
+
+        return out;
+    }
+
+    /**
+     * @brief Multiplies the tensor by a scalar constant.
+     */
+    Tensor operator*(double other) {
+#ifdef RASH_DETAILED_TAGS
+        std::string scalarStr = std::to_string(other);
+#else
+        std::string scalarStr;
+#endif
+        std::string newTag = composeTag({"(", impl->tag, "*", scalarStr, ")"});
+        Tensor out(impl->data_ * other, impl->requiresGrad, newTag);
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::MulScalar;
+        out.impl->scalarOperand = other;
+
+        return out;
+    }
+
+    /**
+     * @brief Divides the tensor by a scalar constant.
+     */
+    Tensor operator/(double other) {
+#ifdef RASH_DETAILED_TAGS
+        std::string scalarStr = std::to_string(other);
+#else
+        std::string scalarStr;
+#endif
+        std::string newTag = composeTag({"(", impl->tag, "/", scalarStr, ")"});
+        Tensor out(impl->data_ / other, impl->requiresGrad, newTag);
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::MulScalar;
+        out.impl->scalarOperand = 1.0 / other;
 
         return out;
     }
@@ -264,19 +864,11 @@ class Tensor {
      * @brief Divides two tensors.
      */
     Tensor operator/(const Tensor& other) {
-        std::string newTag = "(" + impl->tag + "/" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", impl->tag, "/", other.impl->tag, ")"});
         Tensor out(impl->data_ / other.impl->data_, impl->requiresGrad || other.impl->requiresGrad, newTag);
 
-        out.impl->prev = {impl, other.impl};
-        out.impl->_backward = [out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-            auto p1 = out_impl->prev[1].lock();
-
-            if (p0->requiresGrad)
-                p0->accumulateGrad(incGrad / p1->data_);
-            if (p1->requiresGrad)
-                p1->accumulateGrad(-incGrad * (p0->data_ / (p1->data_ * p1->data_)));
-        };
+        linkParents(out.impl, impl, other.impl);
+        out.impl->bwdOp = BackwardOp::Div;
 
         return out;
     }
@@ -285,7 +877,7 @@ class Tensor {
      * @brief Greater than comparison of two tensors.
      */
     Tensor operator>(const Tensor& other) {
-        std::string newTag = "(" + impl->tag + "/" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", impl->tag, "/", other.impl->tag, ")"});
         Tensor out(impl->data_ > other.impl->data_, false, newTag);
 
         return out;
@@ -295,7 +887,7 @@ class Tensor {
      * @brief Greater than equals to comparison of two tensors.
      */
     Tensor operator>=(const Tensor& other) {
-        std::string newTag = "(" + impl->tag + "/" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", impl->tag, "/", other.impl->tag, ")"});
         Tensor out(impl->data_ >= other.impl->data_, false, newTag);
 
         return out;
@@ -305,7 +897,7 @@ class Tensor {
      * @brief Less than comparison of two tensors.
      */
     Tensor operator<(const Tensor& other) {
-        std::string newTag = "(" + impl->tag + "/" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", impl->tag, "/", other.impl->tag, ")"});
         Tensor out(impl->data_ < other.impl->data_, false, newTag);
 
         return out;
@@ -315,7 +907,7 @@ class Tensor {
      * @brief Less than equals to comparison of two tensors.
      */
     Tensor operator<=(const Tensor& other) {
-        std::string newTag = "(" + impl->tag + "/" + other.impl->tag + ")";
+        std::string newTag = composeTag({"(", impl->tag, "/", other.impl->tag, ")"});
         Tensor out(impl->data_ <= other.impl->data_, false, newTag);
 
         return out;
@@ -325,16 +917,11 @@ class Tensor {
      * @brief Computes element-wise exponential of the tensor.
      */
     Tensor exp() {
-        std::string newTag = "exp(" + impl->tag + ")";
+        std::string newTag = composeTag({"exp(", impl->tag, ")"});
         TensorMeta expVal = TensorMeta::exp(impl->data_);
         Tensor out(expVal, impl->requiresGrad, newTag);
-        out.impl->prev = {impl};
-        out.impl->_backward = [expVal = expVal, out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-
-            if (p0->requiresGrad)
-                p0->accumulateGrad(incGrad * expVal);
-        };
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::Exp;
 
         return out;
     }
@@ -343,15 +930,10 @@ class Tensor {
      * @brief Returns the transpose of the tensor.
      */
     Tensor T() const {
-        std::string newTag = impl->tag + ".T";
+        std::string newTag = composeTag({impl->tag, ".T"});
         Tensor out(impl->data_.T(), impl->requiresGrad, newTag);
-        out.impl->prev = {impl};
-        out.impl->_backward = [out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-
-            if (p0->requiresGrad)
-                p0->accumulateGrad(incGrad.T());
-        };
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::Transpose;
 
         return out;
     }
@@ -359,20 +941,47 @@ class Tensor {
     /**
      * @brief Computes matrix multiplication of two tensors.
      */
+    /**
+     * @brief Fused squared-error loss: sum((t1 - t2)^2) as a scalar tensor.
+     *
+     * The expression form (a - b).pow(2).sum() materializes two full
+     * temporaries and walks the data three times; this op is one streaming
+     * pass on the forward and a single FMA sweep per parent on the backward.
+     */
+    static Tensor mseLoss(const Tensor& t1, const Tensor& t2) {
+        std::string newTag = composeTag({"MseLoss(", t1.impl->tag, ",", t2.impl->tag, ")"});
+        Tensor out(TensorMeta::mseSum(t1.impl->data_, t2.impl->data_),
+                   t1.impl->requiresGrad || t2.impl->requiresGrad, newTag);
+        linkParents(out.impl, t1.impl, t2.impl);
+        out.impl->bwdOp = BackwardOp::MseLoss;
+
+        return out;
+    }
+
     static Tensor matmul(const Tensor& t1, const Tensor& t2) {
-        std::string newTag = "(" + t1.impl->tag + "@" + t2.impl->tag + ")";
+        std::string newTag = composeTag({"(", t1.impl->tag, "@", t2.impl->tag, ")"});
         Tensor out(TensorMeta::matmul(t1.impl->data_, t2.impl->data_), t1.impl->requiresGrad || t2.impl->requiresGrad,
                    newTag);
-        out.impl->prev = {t1.impl, t2.impl};
-        out.impl->_backward = [out_impl = out.impl](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
-            auto p1 = out_impl->prev[1].lock();
+        linkParents(out.impl, t1.impl, t2.impl);
+        out.impl->bwdOp = BackwardOp::MatMul;
+
+        return out;
+    }
 
-            if (p0->requiresGrad)
-                p0->accumulateGrad(TensorMeta::matmul(incGrad, p1->data_.transpose()));
-            if (p1->requiresGrad)
-                p1->accumulateGrad(TensorMeta::matmul(p0->data_.transpose(), incGrad));
-        };
+    /**
+     * @brief Matrix product t1 @ t2^T without materializing the transpose.
+     *
+     * matmul(t1, t2.T()) copies the full weight matrix through permute on
+     * every call; in a training loop that is one wasted transpose per step.
+     * GEMM reads the untransposed buffer with swapped strides instead, and
+     * the backward pass likewise runs on the original operands.
+     */
+    static Tensor matmulNT(const Tensor& t1, const Tensor& t2) {
+        std::string newTag = composeTag({"(", t1.impl->tag, "@", t2.impl->tag, "^T)"});
+        Tensor out(TensorMeta::matmulTrans(t1.impl->data_, t2.impl->data_, false, true),
+                   t1.impl->requiresGrad || t2.impl->requiresGrad, newTag);
+        linkParents(out.impl, t1.impl, t2.impl);
+        out.impl->bwdOp = BackwardOp::MatMulNT;
 
         return out;
     }
@@ -381,16 +990,12 @@ class Tensor {
      *  @brief Computes power of a tensor
      */
     Tensor pow(int n) {
-        std::string newTag = "(" + impl->tag + "^" + std::to_string(n) + ")";
+        std::string newTag = composeTag({"(", impl->tag, "^", std::to_string(n), ")"});
         Tensor out(TensorMeta::pow(impl->data_, n), impl->requiresGrad, newTag);
-        out.impl->prev = {impl};
-        out.impl->_backward = [out_impl = out.impl, n = n](TensorMeta incGrad) {
-            auto p0 = out_impl->prev[0].lock();
+        linkParents(out.impl, impl);
+        out.impl->bwdOp = BackwardOp::Pow;
+        out.impl->powExp = n;
 
-            if (p0->requiresGrad) {
-                p0->accumulateGrad((TensorMeta::pow(p0->data_, n - 1) * double(n)) * incGrad);
-            }
-        };
         return out;
     }
 
@@ -408,23 +1013,17 @@ class Tensor {
      * @brief Performs backpropagation from this tensor.
      */
     void backward() {
-        impl->gradVisited.clear();
-        impl->grad.updateAll(1.0);
+        impl->fetchGrad().updateAll(1.0);
         impl->backward();
-        impl->_backward = nullptr;
-        // for (auto& [id, impl] : tempStorage) {
-        //     impl = nullptr;
-        // }
-        // tempStorage.clear();
     }
 
     /**
      * @brief Generates a random tensor.
      */
     static Tensor rand(const std::vector<int>& shape, bool requiresGrad = false, std::string tensorTag = "") {
-        TensorMeta out(shape);
+        TensorMeta out = TensorMeta::uninit(shape);
         out.fillRandomData();
-        return Tensor(out, requiresGrad, tensorTag);
+        return Tensor(std::move(out), requiresGrad, std::move(tensorTag));
     }
 
     /**
@@ -434,21 +1033,21 @@ class Tensor {
 
     void updateData(TensorMeta updatedData) {
         assert(impl->data_.shape() == updatedData.shape() && "Tensor Data Update Failed. Inconsistent incoming data!");
-        impl->updateData(updatedData);
+        impl->updateData(std::move(updatedData));
     }
 
     /**
      * @brief Retrieves the gradient of the tensor.
      */
-    TensorMeta fetchGrad() const { return impl->grad; }
+    TensorMeta fetchGrad() const { return impl->fetchGrad(); }
 
     /**
      * @brief Updates the gradient with a new value.
      */
     void updateGrad(TensorMeta incGrad) {
-        assert(incGrad.shape() == impl->grad.shape() && "Grad Shape should match!");
-        impl->updateGrad(incGrad);
+        assert(incGrad.shape() == impl->data_.shape() && "Grad Shape should match!");
+        impl->updateGrad(std::move(incGrad));
     }
 };
 
-}  // namespace rash
\ No newline at end of file
+}  // namespace rash
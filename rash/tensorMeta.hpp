@@ -3,29 +3,448 @@
 
 #include <algorithm>
 #include <cassert>
-#include <functional>
-#include <iostream>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <map>
+#include <ostream>
 #include <random>
-#include <set>
+#include <sstream>
+#include <type_traits>
 #include <vector>
 
+#include "simd.hpp"
 #include "utils.hpp"
 
 #define DOUBLE_MAX std::numeric_limits<double>::infinity()
 
 namespace rash {
 
+/**
+ * @brief Size-keyed recycling pool behind the tensor-buffer allocator.
+ *
+ * A training loop rebuilds the same expression graph every step, so the
+ * forward pass requests the same handful of buffer sizes over and over.
+ * Instead of round-tripping each one through the system allocator, freed
+ * blocks are parked here per exact byte size and handed straight back on the
+ * next request, keeping buffer turnover allocation-free in steady state.
+ * The pool is thread_local (no locking) and keeps at most a few blocks per
+ * size so oddball shapes cannot pin memory forever.
+ */
+class AlignedBufferPool {
+    static constexpr size_t kMaxPerSize = 8;
+    std::map<size_t, std::vector<void*>> freeBlocks;
+
+   public:
+    void* fetch(size_t bytes) {
+        auto it = freeBlocks.find(bytes);
+        if (it == freeBlocks.end() || it->second.empty())
+            return nullptr;
+        void* ptr = it->second.back();
+        it->second.pop_back();
+        return ptr;
+    }
+
+    bool store(size_t bytes, void* ptr) {
+        std::vector<void*>& bucket = freeBlocks[bytes];
+        if (bucket.size() >= kMaxPerSize)
+            return false;
+        bucket.push_back(ptr);
+        return true;
+    }
+
+    ~AlignedBufferPool() {
+        for (auto& [bytes, bucket] : freeBlocks) {
+            for (void* ptr : bucket) {
+                ::operator delete(ptr, std::align_val_t(64));
+            }
+        }
+    }
+
+    static AlignedBufferPool& instance() {
+        thread_local AlignedBufferPool pool;
+        return pool;
+    }
+};
+
+/**
+ * @brief Worker count shared by the opt-in parallel paths.
+ *
+ * Read once from RASH_NUM_THREADS; unset or <=1 keeps every loop
+ * sequential, so threading stays strictly opt-in even in OpenMP builds.
+ */
+inline int configuredThreads() {
+    static const int n = [] {
+        const char* env = std::getenv("RASH_NUM_THREADS");
+        return env ? std::atoi(env) : 1;
+    }();
+    return n;
+}
+
+/**
+ * @brief Minimal allocator handing out blocks on a fixed alignment boundary.
+ *
+ * std::vector<double>'s default allocator only guarantees 16-byte alignment,
+ * which forces every SIMD kernel onto unaligned loads; those still split
+ * across cache lines on older microarchitectures and rule out safe aligned
+ * AVX-512 later. Backing tensor storage with 64-byte blocks (one full cache
+ * line) lets the kernels use aligned load/store throughout. Blocks are
+ * recycled through the AlignedBufferPool rather than returned to the system
+ * allocator, so steady-state graph rebuilds allocate nothing.
+ */
+template <typename T, size_t Alignment>
+struct AlignedAllocator {
+    using value_type = T;
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    // Sizes are rounded up to whole alignment blocks, so every buffer ends on
+    // a cache-line boundary (full-width SIMD loads at the tail never fault)
+    // and near-miss sizes share one pool size class instead of fragmenting it.
+    static size_t paddedBytes(size_t n) { return (n * sizeof(T) + Alignment - 1) / Alignment * Alignment; }
+
+    T* allocate(size_t n) {
+        size_t bytes = paddedBytes(n);
+        if (void* recycled = AlignedBufferPool::instance().fetch(bytes))
+            return static_cast<T*>(recycled);
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        if (!AlignedBufferPool::instance().store(paddedBytes(n), ptr))
+            ::operator delete(ptr, std::align_val_t(Alignment));
+    }
+
+    // Default-initialize on plain resize: new doubles are left unwritten, so
+    // TensorMeta::uninit can size a buffer without a zeroing pass. assign()
+    // and the fill constructors still write their value as before.
+    template <typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    bool operator==(const AlignedAllocator&) const { return true; }
+    bool operator!=(const AlignedAllocator&) const { return false; }
+};
+
+/**
+ * @brief Cache-line-aligned double buffer used for all tensor storage.
+ */
+using AlignedVector = std::vector<double, AlignedAllocator<double, 64>>;
+
+/**
+ * @brief Accumulates the divisor gradient of a division in one fused pass.
+ *
+ * The naive formula materializes b*b, then a/(b*b), then the product with the
+ * incoming gradient - three temporaries and four sweeps - before subtracting
+ * from the parent gradient. This kernel computes
+ * gradOut[i] -= g[i] * a[i] / (b[i] * b[i]) directly, using FNMADD against
+ * the reciprocal of b*b when the AVX2+FMA clone is selected at runtime, and
+ * is only valid when all four buffers share one shape.
+ *
+ * All four buffers must be 32-byte aligned (tensor storage is).
+ *
+ * @param g The incoming gradient of the quotient.
+ * @param a The dividend data.
+ * @param b The divisor data.
+ * @param gradOut The divisor's gradient accumulator, updated in place.
+ * @param n Number of elements.
+ */
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx2,fma"))) inline size_t divGradKernelAvx2(const double* g, const double* a, const double* b,
+                                                                    double* gradOut, size_t n) {
+    size_t idx = 0;
+    const __m256d one = _mm256_set1_pd(1.0);
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d num = _mm256_mul_pd(_mm256_load_pd(g + idx), _mm256_load_pd(a + idx));
+        __m256d bv = _mm256_load_pd(b + idx);
+        __m256d inv = _mm256_div_pd(one, _mm256_mul_pd(bv, bv));
+        __m256d acc = _mm256_load_pd(gradOut + idx);
+        _mm256_store_pd(gradOut + idx, _mm256_fnmadd_pd(num, inv, acc));
+    }
+    return idx;
+}
+#endif
+
+inline void divGradKernel(const double* g, const double* a, const double* b, double* gradOut, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx2Fma())
+        idx = divGradKernelAvx2(g, a, b, gradOut, n);
+#endif
+    for (; idx < n; ++idx) {
+        gradOut[idx] -= g[idx] * a[idx] / (b[idx] * b[idx]);
+    }
+}
+
+/**
+ * @brief Accumulates the pow backward in one fused pass: acc[i] += e * x[i]^(e-1) * g[i].
+ *
+ * The expression form materialized pow(x, e-1), scaled it by e and multiplied
+ * by the incoming gradient - temporaries and separate sweeps before the final
+ * accumulate. The integer exponent (the only form pow() accepts) lets the
+ * power unroll into e-1 plain multiplies per lane, so the whole edge is one
+ * streaming FMA loop. Valid for e >= 1; all buffers share one shape.
+ *
+ * @param g The incoming gradient.
+ * @param x The forward input data.
+ * @param acc The parent gradient accumulator, updated in place.
+ * @param n Number of elements.
+ * @param e The integer exponent of the forward pow.
+ */
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx2,fma"))) inline size_t powGradKernelAvx2(const double* g, const double* x, double* acc,
+                                                                    size_t n, int e) {
+    size_t idx = 0;
+    const __m256d coeff = _mm256_set1_pd(double(e));
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d xv = _mm256_load_pd(x + idx);
+        __m256d p = coeff;
+        for (int k = 0; k < e - 1; ++k) {
+            p = _mm256_mul_pd(p, xv);
+        }
+        _mm256_store_pd(acc + idx, _mm256_fmadd_pd(p, _mm256_load_pd(g + idx), _mm256_load_pd(acc + idx)));
+    }
+    return idx;
+}
+#endif
+
+inline void powGradKernel(const double* g, const double* x, double* acc, size_t n, int e) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx2Fma())
+        idx = powGradKernelAvx2(g, x, acc, n, e);
+#endif
+    for (; idx < n; ++idx) {
+        double p = double(e);
+        for (int k = 0; k < e - 1; ++k) {
+            p *= x[idx];
+        }
+        acc[idx] += p * g[idx];
+    }
+}
+
+/**
+ * @brief Advances a splitmix64 state and returns the next value.
+ *
+ * Used only to expand one seed into the xoshiro256+ state words.
+ */
+inline uint64_t splitmix64Next(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Fills a buffer with uniform [0, 1) doubles from xoshiro256+ streams.
+ *
+ * The old fill path asked std::mt19937 + uniform_real_distribution for one
+ * value per element. xoshiro256+ produces a double per a handful of xors and
+ * shifts, and when the AVX2 clone is selected at runtime four independent
+ * lane streams advance in lockstep. The top 52 random bits are placed
+ * straight into the mantissa of a [1, 2) double which is then shifted down
+ * to [0, 1), so no integer-to-float conversion is needed.
+ *
+ * @param dst The output buffer.
+ * @param n Number of elements.
+ * @param seed Seed expanded via splitmix64 into the stream states.
+ */
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx2"))) inline size_t randomUniformKernelAvx2(double* dst, size_t n, uint64_t& seed) {
+    size_t idx = 0;
+    alignas(32) uint64_t seedWords[4][4];
+    for (int lane = 0; lane < 4; ++lane) {
+        for (int word = 0; word < 4; ++word) {
+            seedWords[word][lane] = splitmix64Next(seed);
+        }
+    }
+    __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(seedWords[0]));
+    __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(seedWords[1]));
+    __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(seedWords[2]));
+    __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(seedWords[3]));
+    const __m256i expOne = _mm256_set1_epi64x(0x3FF0000000000000LL);
+    const __m256d one = _mm256_set1_pd(1.0);
+
+    for (; idx + 4 <= n; idx += 4) {
+        __m256i bits = _mm256_add_epi64(s0, s3);
+        bits = _mm256_or_si256(_mm256_srli_epi64(bits, 12), expOne);
+        _mm256_store_pd(dst + idx, _mm256_sub_pd(_mm256_castsi256_pd(bits), one));
+
+        __m256i t = _mm256_slli_epi64(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+    }
+    seed = splitmix64Next(seed);
+    return idx;
+}
+#endif
+
+inline void randomUniformKernel(double* dst, size_t n, uint64_t seed) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx2Fma())
+        idx = randomUniformKernelAvx2(dst, n, seed);
+#endif
+    uint64_t s[4];
+    for (int word = 0; word < 4; ++word) {
+        s[word] = splitmix64Next(seed);
+    }
+    for (; idx < n; ++idx) {
+        uint64_t bits = ((s[0] + s[3]) >> 12) | 0x3FF0000000000000ULL;
+        double val;
+        std::memcpy(&val, &bits, sizeof(val));
+        dst[idx] = val - 1.0;
+
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = (s[3] << 45) | (s[3] >> 19);
+    }
+}
+
+/**
+ * @brief Computes exp over a raw buffer, four lanes at a time when possible.
+ *
+ * Scalar std::exp per element left the whole buffer latency-bound on one libm
+ * call after another. The AVX2+FMA clone, selected at runtime, evaluates the
+ * Cephes rational approximation (exp(r) = 1 + 2r*P(r^2) / (Q(r^2) - r*P(r^2))
+ * after range reduction by log2(e)) across four lanes and rebuilds 2^n
+ * through the exponent bits, with inputs clamped to the finite double range.
+ * Falls back to scalar libm per element otherwise and for the tail.
+ *
+ * @param src The input buffer.
+ * @param dst The output buffer (may alias src).
+ * @param n Number of elements.
+ */
+#ifdef RASH_X86_DISPATCH
+__attribute__((target("avx512f"))) inline size_t expKernelAvx512(const double* src, double* dst, size_t n) {
+    size_t idx = 0;
+    const __m512d maxX = _mm512_set1_pd(709.436);
+    const __m512d minX = _mm512_set1_pd(-708.396);
+    const __m512d log2e = _mm512_set1_pd(1.4426950408889634074);
+    const __m512d c1 = _mm512_set1_pd(6.93145751953125E-1);
+    const __m512d c2 = _mm512_set1_pd(1.42860682030941723212E-6);
+    const __m512d p0 = _mm512_set1_pd(1.26177193074810590878E-4);
+    const __m512d p1 = _mm512_set1_pd(3.02994407707441961300E-2);
+    const __m512d p2 = _mm512_set1_pd(9.99999999999999999910E-1);
+    const __m512d q0 = _mm512_set1_pd(3.00198505138664455042E-6);
+    const __m512d q1 = _mm512_set1_pd(2.52448340349684104192E-3);
+    const __m512d q2 = _mm512_set1_pd(2.27265548208155028766E-1);
+    const __m512d q3 = _mm512_set1_pd(2.00000000000000000005E0);
+
+    for (; idx + 8 <= n; idx += 8) {
+        __m512d x = _mm512_load_pd(src + idx);
+        x = _mm512_min_pd(maxX, _mm512_max_pd(minX, x));
+
+        // Reduce to x = r + k*ln(2) with r in [-ln2/2, ln2/2].
+        __m512d k = _mm512_floor_pd(_mm512_fmadd_pd(log2e, x, _mm512_set1_pd(0.5)));
+        x = _mm512_fnmadd_pd(k, c1, x);
+        x = _mm512_fnmadd_pd(k, c2, x);
+
+        __m512d xx = _mm512_mul_pd(x, x);
+        __m512d px = _mm512_fmadd_pd(p0, xx, p1);
+        px = _mm512_mul_pd(_mm512_fmadd_pd(px, xx, p2), x);
+        __m512d qx = _mm512_fmadd_pd(q0, xx, q1);
+        qx = _mm512_fmadd_pd(qx, xx, q2);
+        qx = _mm512_fmadd_pd(qx, xx, q3);
+        __m512d e = _mm512_div_pd(px, _mm512_sub_pd(qx, px));
+        e = _mm512_fmadd_pd(_mm512_set1_pd(2.0), e, _mm512_set1_pd(1.0));
+
+        // Multiply by 2^k by building the exponent bits directly.
+        __m512i k64 = _mm512_cvtepi32_epi64(_mm512_cvtpd_epi32(k));
+        k64 = _mm512_slli_epi64(_mm512_add_epi64(k64, _mm512_set1_epi64(1023)), 52);
+        e = _mm512_mul_pd(e, _mm512_castsi512_pd(k64));
+
+        _mm512_store_pd(dst + idx, e);
+    }
+    return idx;
+}
+
+__attribute__((target("avx2,fma"))) inline size_t expKernelAvx2(const double* src, double* dst, size_t n) {
+    size_t idx = 0;
+    const __m256d maxX = _mm256_set1_pd(709.436);
+    const __m256d minX = _mm256_set1_pd(-708.396);
+    const __m256d log2e = _mm256_set1_pd(1.4426950408889634074);
+    const __m256d c1 = _mm256_set1_pd(6.93145751953125E-1);
+    const __m256d c2 = _mm256_set1_pd(1.42860682030941723212E-6);
+    const __m256d p0 = _mm256_set1_pd(1.26177193074810590878E-4);
+    const __m256d p1 = _mm256_set1_pd(3.02994407707441961300E-2);
+    const __m256d p2 = _mm256_set1_pd(9.99999999999999999910E-1);
+    const __m256d q0 = _mm256_set1_pd(3.00198505138664455042E-6);
+    const __m256d q1 = _mm256_set1_pd(2.52448340349684104192E-3);
+    const __m256d q2 = _mm256_set1_pd(2.27265548208155028766E-1);
+    const __m256d q3 = _mm256_set1_pd(2.00000000000000000005E0);
+
+    for (; idx + 4 <= n; idx += 4) {
+        __m256d x = _mm256_load_pd(src + idx);
+        x = _mm256_min_pd(maxX, _mm256_max_pd(minX, x));
+
+        // Reduce to x = r + k*ln(2) with r in [-ln2/2, ln2/2].
+        __m256d k = _mm256_floor_pd(_mm256_fmadd_pd(log2e, x, _mm256_set1_pd(0.5)));
+        x = _mm256_fnmadd_pd(k, c1, x);
+        x = _mm256_fnmadd_pd(k, c2, x);
+
+        __m256d xx = _mm256_mul_pd(x, x);
+        __m256d px = _mm256_fmadd_pd(p0, xx, p1);
+        px = _mm256_mul_pd(_mm256_fmadd_pd(px, xx, p2), x);
+        __m256d qx = _mm256_fmadd_pd(q0, xx, q1);
+        qx = _mm256_fmadd_pd(qx, xx, q2);
+        qx = _mm256_fmadd_pd(qx, xx, q3);
+        __m256d e = _mm256_div_pd(px, _mm256_sub_pd(qx, px));
+        e = _mm256_fmadd_pd(_mm256_set1_pd(2.0), e, _mm256_set1_pd(1.0));
+
+        // Multiply by 2^k by building the exponent bits directly.
+        __m256i k64 = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k));
+        k64 = _mm256_slli_epi64(_mm256_add_epi64(k64, _mm256_set1_epi64x(1023)), 52);
+        e = _mm256_mul_pd(e, _mm256_castsi256_pd(k64));
+
+        _mm256_store_pd(dst + idx, e);
+    }
+    return idx;
+}
+#endif
+
+inline void expKernel(const double* src, double* dst, size_t n) {
+    size_t idx = 0;
+#ifdef RASH_X86_DISPATCH
+    if (cpuHasAvx512())
+        idx = expKernelAvx512(src, dst, n);
+    else if (cpuHasAvx2Fma())
+        idx = expKernelAvx2(src, dst, n);
+#endif
+    for (; idx < n; ++idx) {
+        dst[idx] = std::exp(src[idx]);
+    }
+}
+
 /**
  * @class TensorMeta
  * @brief A class to represent tensor data with various operations and transformations.
  */
 class TensorMeta {
-    int numel;
+    // 64-bit: the element count of a modest 3-D tensor (e.g. 2048^3) already
+    // overflows int, and every flat loop below is bounded by it.
+    long long numel = 0;
     std::vector<int> tensorSize;
 
    public:
-    std::vector<double> rawData;
+    AlignedVector rawData;
 
 #pragma region DataDefinition
     /**
@@ -34,16 +453,37 @@ class TensorMeta {
      * @param size The shape of the tensor.
      * @throws std::runtime_error if the data size does not match the tensor shape.
      */
-    TensorMeta(std::vector<double> data, std::vector<int> size) : tensorSize(size), rawData(data) {
+    TensorMeta(std::vector<double> data, std::vector<int> size)
+        : tensorSize(size), rawData(data.begin(), data.end()) {
         numel = 1;
         for (auto& dim : tensorSize) {
             numel *= dim;
         }
-        if (rawData.size() != numel) {
+        if (rawData.size() != size_t(numel)) {
             throw std::runtime_error("Data size mismatch with tensorSize!");
         }
     }
 
+    /**
+     * @brief Builds a TensorMeta adopting an already-aligned buffer without a copy.
+     * @param data The aligned raw data, moved in.
+     * @param size The shape of the tensor.
+     * @throws std::runtime_error if the data size does not match the tensor shape.
+     */
+    static TensorMeta fromRaw(AlignedVector data, std::vector<int> size) {
+        TensorMeta out;
+        out.tensorSize = std::move(size);
+        out.rawData = std::move(data);
+        out.numel = 1;
+        for (auto& dim : out.tensorSize) {
+            out.numel *= dim;
+        }
+        if (out.rawData.size() != size_t(out.numel)) {
+            throw std::runtime_error("Data size mismatch with tensorSize!");
+        }
+        return out;
+    }
+
     /**
      * @brief Constructs a scalar TensorMeta object.
      * @param data The scalar value.
@@ -51,7 +491,7 @@ class TensorMeta {
     TensorMeta(double data) : tensorSize({1}), rawData({data}) { numel = 1; }
 
     /**
-     * @brief Constructs a TensorMeta object with a given shape and initializes it with random values.
+     * @brief Constructs a zero-filled TensorMeta object with a given shape.
      * @param size The shape of the tensor.
      */
     TensorMeta(std::vector<int> size) : tensorSize(size) {
@@ -60,13 +500,50 @@ class TensorMeta {
         for (auto& dim : tensorSize) {
             numel *= dim;
         }
-        rawData.assign(numel, 0.0);
+        // resize leaves the buffer untouched (default-init allocator hook);
+        // one guaranteed memset zeroes it instead of a per-element assign.
+        rawData.resize(numel);
+        std::memset(rawData.data(), 0, size_t(numel) * sizeof(double));
     }
     /**
      * @brief Default constructor for TensorMeta.
      */
     TensorMeta() = default;
 
+    /**
+     * @brief Creates a zero-filled tensor with the same shape as the given one.
+     *
+     * The shape is copied and the buffer value-initialized in one step, so no
+     * element is written twice on the way to a zeroed tensor.
+     *
+     * @param meta The tensor whose shape to mirror.
+     * @return The zero-filled tensor.
+     */
+    static TensorMeta zerosLike(const TensorMeta& meta) { return TensorMeta(meta.tensorSize); }
+
+    /**
+     * @brief Creates a tensor of the given shape with uninitialized storage.
+     *
+     * Outputs that every kernel writes in full (elementwise sweeps, GEMM with
+     * beta=0, broadcast) pay for the shape constructor's zeroing pass without
+     * ever reading a zero. The allocator default-initializes on plain resize,
+     * so this only sizes the buffer. Callers must write every element before
+     * reading any.
+     *
+     * @param size The shape of the tensor.
+     * @return The tensor with untouched storage.
+     */
+    static TensorMeta uninit(std::vector<int> size) {
+        TensorMeta out;
+        out.tensorSize = std::move(size);
+        out.numel = 1;
+        for (auto& dim : out.tensorSize) {
+            out.numel *= dim;
+        }
+        out.rawData.resize(out.numel);
+        return out;
+    }
+
     /**
      * @brief Default destructor for TensorMeta.
      */
@@ -75,54 +552,85 @@ class TensorMeta {
     /**
      * @brief Copy constructor for TensorMeta.
      */
-    TensorMeta(const TensorMeta& other) : numel(other.numel), tensorSize(other.tensorSize), rawData(other.rawData) {}
+    TensorMeta(const TensorMeta& other) = default;
+
+    /**
+     * @brief Copy assignment for TensorMeta.
+     */
+    TensorMeta& operator=(const TensorMeta& other) = default;
+
+    // Even defaulted, the user-declared copy constructor above suppresses the implicit move
+    // operations, which silently turned every std::move of a TensorMeta
+    // (graph-node construction, the reduce loop, += broadcast fallbacks) into
+    // a full rawData copy. Restore them: moves steal the buffer, no element
+    // traffic.
+    TensorMeta(TensorMeta&& other) noexcept = default;
+    TensorMeta& operator=(TensorMeta&& other) noexcept = default;
 
     /**
      * @brief Fills the tensor with random values between 0 and 1.
      */
     void fillRandomData() {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_real_distribution<> dis(0, 1);
-
-        for (int i = 0; i < numel; i++) {
-            rawData[i] = dis(gen);
-        }
+        // One entropy tap per thread; later fills advance the splitmix64
+        // stream instead of reopening the entropy source per tensor.
+        static thread_local uint64_t seedState = (uint64_t(std::random_device{}()) << 32) ^ std::random_device{}();
+        randomUniformKernel(rawData.data(), numel, splitmix64Next(seedState));
     }
 
     /**
      * @brief Updates all tensor elements to a specified value.
+     *
+     * Zero goes through one memset; other values take the SIMD fill kernel,
+     * which streams past the cache for large buffers. Either way this is a
+     * single pass with no per-element construction.
+     *
      * @param value The new value for all elements.
      */
-    void updateAll(double value) { rawData.assign(numel, value); }
+    void updateAll(double value) {
+        if (rawData.size() != size_t(numel)) {
+            rawData.resize(numel);
+        }
+        if (value == 0.0) {
+            std::memset(rawData.data(), 0, rawData.size() * sizeof(double));
+            return;
+        }
+        vecFillF64(rawData.data(), value, rawData.size());
+    }
+
+    /**
+     * @brief Zeroes the existing buffer with one memset, no element loop.
+     */
+    void zeroFill() { std::memset(rawData.data(), 0, rawData.size() * sizeof(double)); }
 
     /**
      * @brief Shows the tensor data in a formatted manner.
+     *
+     * Recursion descends by dimension index against the precomputed strides,
+     * so no level copies the shape or recounts the elements beneath it.
+     *
      * @param os The output stream.
      * @param shape The shape of the tensor.
+     * @param dim The dimension this level prints.
      * @param flattenedData The flattened data of the tensor.
+     * @param stride Element count under each dimension.
      * @param startIdx The starting index for displaying.
      */
-    static void showRecursive(std::ostream& os, std::vector<int> shape, const std::vector<double>& flattenedData,
-                              int startIdx = 0) {
-        if (shape.size() == 1) {
+    static void showRecursive(std::ostream& os, const std::vector<int>& shape, size_t dim,
+                              const AlignedVector& flattenedData, const std::vector<int>& stride, int startIdx = 0) {
+        if (dim + 1 == shape.size()) {
             os << "[";
-            for (int i = startIdx; i < startIdx + shape[0] - 1; i++) {
+            for (int i = startIdx; i < startIdx + shape[dim] - 1; i++) {
                 os << flattenedData[i] << " ,";
             }
-            os << flattenedData[startIdx + shape[0] - 1] << "]";
+            os << flattenedData[startIdx + shape[dim] - 1] << "]";
         } else {
-            std::vector<int> childShape(shape.begin() + 1, shape.end());
-            int totalElPerDim = 1;
-            for (auto el : childShape) {
-                totalElPerDim *= el;
-            }
+            int totalElPerDim = stride[dim];
             os << "[";
-            for (int i = 0; i < shape[0] - 1; i++) {
-                showRecursive(os, childShape, flattenedData, startIdx + (i * totalElPerDim));
+            for (int i = 0; i < shape[dim] - 1; i++) {
+                showRecursive(os, shape, dim + 1, flattenedData, stride, startIdx + (i * totalElPerDim));
                 os << ", \n";
             }
-            showRecursive(os, childShape, flattenedData, startIdx + ((shape[0] - 1) * totalElPerDim));
+            showRecursive(os, shape, dim + 1, flattenedData, stride, startIdx + ((shape[dim] - 1) * totalElPerDim));
             os << "]";
         }
     }
@@ -131,7 +639,13 @@ class TensorMeta {
      * @brief Displays the tensor in a formatted manner.
      */
     static void display(std::ostream& oss, const TensorMeta& meta) {
-        showRecursive(oss, meta.tensorSize, meta.rawData, 0);
+        // Stage the whole render in a local buffer so the destination stream
+        // (with its per-insertion locale and locking costs) is touched once,
+        // not once per element. copyfmt keeps the output byte-identical.
+        std::ostringstream buf;
+        buf.copyfmt(oss);
+        showRecursive(buf, meta.tensorSize, 0, meta.rawData, fetchStride(meta.tensorSize), 0);
+        oss << buf.str();
     }
 
     /**
@@ -145,19 +659,35 @@ class TensorMeta {
 #pragma endregion
 
     /**
-     * @brief Removes singleton dimensions from the tensor.
-     * @param dims The dimensions to be squeezed.
-     * @return A new TensorMeta object with squeezed dimensions.
+     * @brief Computes the shape left after erasing the given singleton dims.
+     * @param dims The dimensions to be squeezed; sorted in place.
+     * @return The squeezed shape.
      */
-    TensorMeta squeeze(std::vector<int> dims) const {
+    std::vector<int> squeezedShape(std::vector<int>& dims) const {
         std::vector<int> newSize(tensorSize);
         std::sort(dims.begin(), dims.end(), std::greater<>());
         for (auto& idx : dims) {
             if (idx < ndim() && tensorSize[idx] == 1)
                 newSize.erase(newSize.begin() + idx);
         }
+        return newSize;
+    }
 
-        return TensorMeta(rawData, newSize);
+    /**
+     * @brief Removes singleton dimensions from the tensor.
+     *
+     * Shape-only ops are ref-qualified: called on an rvalue (the matmul
+     * plumbing chains them on temporaries) the buffer moves instead of
+     * copying.
+     *
+     * @param dims The dimensions to be squeezed.
+     * @return A new TensorMeta object with squeezed dimensions.
+     */
+    TensorMeta squeeze(std::vector<int> dims) const& { return TensorMeta::fromRaw(rawData, squeezedShape(dims)); }
+
+    TensorMeta squeeze(std::vector<int> dims) && {
+        std::vector<int> newSize = squeezedShape(dims);
+        return TensorMeta::fromRaw(std::move(rawData), std::move(newSize));
     }
 
     /**
@@ -165,63 +695,86 @@ class TensorMeta {
      * @param dim The dimension to be squeezed.
      * @return A new TensorMeta object.
      */
-    TensorMeta squeeze(int dim = 0) const {
+    TensorMeta squeeze(int dim = 0) const& {
         std::vector<int> dims = {dim};
         return squeeze(dims);
     }
 
+    TensorMeta squeeze(int dim = 0) && {
+        std::vector<int> dims = {dim};
+        return std::move(*this).squeeze(dims);
+    }
+
     /**
      * @brief Expands the tensor by inserting a singleton dimension.
      * @param dim The position of the new dimension.
      * @return A new TensorMeta object.
      */
-    TensorMeta unsqueeze(int dim = 0) const {
+    TensorMeta unsqueeze(int dim = 0) const& {
+        std::vector<int> newSize(tensorSize);
+        newSize.insert(newSize.begin() + dim, 1);
+        return TensorMeta::fromRaw(rawData, newSize);
+    }
+
+    TensorMeta unsqueeze(int dim = 0) && {
         std::vector<int> newSize(tensorSize);
         newSize.insert(newSize.begin() + dim, 1);
-        return TensorMeta(rawData, newSize);
+        return TensorMeta::fromRaw(std::move(rawData), std::move(newSize));
     }
 
     /**
-     * @brief Computes the broadcasted shape for two tensors.
+     * @brief Computes the broadcasted shape for two tensors without throwing.
+     *
+     * Validity probes (validateMatmul on every matmul call) used to drive
+     * this through the throwing variant inside a try/catch, paying exception
+     * setup and a heap-allocated exception object just to learn "no". This
+     * reports incompatibility through the return value instead.
+     *
      * @param sz1 The shape of the first tensor.
      * @param sz2 The shape of the second tensor.
-     * @return The broadcasted shape.
-     * @throws std::length_error if broadcasting is not possible.
+     * @param finSize Receives the broadcasted shape on success.
+     * @return True if the shapes broadcast; false otherwise.
      */
-    static std::vector<int> fetchBroadcastedSize(const std::vector<int>& sz1, const std::vector<int>& sz2) {
+    static bool tryFetchBroadcastedSize(const std::vector<int>& sz1, const std::vector<int>& sz2,
+                                        std::vector<int>& finSize) {
         if (!sz1.size() || !sz2.size()) {
-            throw std::length_error("Tensor should have atleats a dimension!");
-            std::exit(-1);
+            return false;
         }
 
-        std::vector<int> curr(sz1.rbegin(), sz1.rend()), incm(sz2.rbegin(), sz2.rend());
-
-        int idx = 0;
-        int n = curr.size(), m = incm.size();
-        std::vector<int> finSize;
-        while (idx < n || idx < m) {
-            if (idx < n && idx < m) {
-                if (curr[idx] == 0 || incm[idx] == 0) {
-                    throw std::runtime_error("Size mismatch in Broadcasting");
-                    std::exit(-1);
-                } else if (curr[idx] == incm[idx]) {
-                    finSize.push_back(curr[idx]);
-                } else if (curr[idx] == 1) {
-                    finSize.push_back(incm[idx]);
-                } else if (incm[idx] == 1) {
-                    finSize.push_back(curr[idx]);
-                } else {
-                    throw std::length_error("Size mismatch in Broadcasting");
-                }
-            } else if (idx < n) {
-                finSize.push_back(curr[idx]);
-            } else if (idx < m) {
-                finSize.push_back(incm[idx]);
+        // Walk both shapes from the tail and fill the result right-aligned
+        // in place: no reversed working copies, no final reverse pass.
+        const int n = sz1.size(), m = sz2.size();
+        const int outN = std::max(n, m);
+        finSize.assign(outN, 0);
+        for (int k = 0; k < outN; ++k) {
+            const int a = k < n ? sz1[n - 1 - k] : 1;
+            const int b = k < m ? sz2[m - 1 - k] : 1;
+            if (k < n && k < m && (a == 0 || b == 0)) {
+                return false;
+            } else if (a == b || b == 1) {
+                finSize[outN - 1 - k] = a;
+            } else if (a == 1) {
+                finSize[outN - 1 - k] = b;
+            } else {
+                return false;
             }
-            idx++;
         }
-        std::reverse(finSize.begin(), finSize.end());
 
+        return true;
+    }
+
+    /**
+     * @brief Computes the broadcasted shape for two tensors.
+     * @param sz1 The shape of the first tensor.
+     * @param sz2 The shape of the second tensor.
+     * @return The broadcasted shape.
+     * @throws std::length_error if broadcasting is not possible.
+     */
+    static std::vector<int> fetchBroadcastedSize(const std::vector<int>& sz1, const std::vector<int>& sz2) {
+        std::vector<int> finSize;
+        if (!tryFetchBroadcastedSize(sz1, sz2, finSize)) {
+            throw std::length_error("Size mismatch in Broadcasting");
+        }
         return finSize;
     }
 
@@ -274,29 +827,93 @@ class TensorMeta {
      * @param op The operation function.
      * @return The resulting tensor after applying the operation.
      */
-    static TensorMeta broadcast(const TensorMeta& dat1, const TensorMeta& dat2,
-                                std::function<double(double, double)> op) {
-        TensorMeta out(fetchBroadcastedSize(dat1, dat2));
-
-        std::vector<int> indices(out.ndim(), 0);
+    template <typename Op>
+    static TensorMeta broadcast(const TensorMeta& dat1, const TensorMeta& dat2, Op&& op) {
+        TensorMeta out = TensorMeta::uninit(fetchBroadcastedSize(dat1, dat2));
+
+        // Equal shapes need none of the index machinery: one contiguous loop
+        // the compiler can vectorize now that the op inlines. Callers without
+        // their own fast path (pow, abs, custom ops) land here too.
+        if (dat1.tensorSize == dat2.tensorSize) {
+            for (long long idx = 0; idx < out.numel; ++idx) {
+                out.rawData[idx] = op(dat1.rawData[idx], dat2.rawData[idx]);
+            }
+            return out;
+        }
 
+        // Mixed shapes: precompute per-output-dim strides for each operand
+        // (0 where the operand is broadcast along that axis) and keep both
+        // offsets updated incrementally by the odometer carry loop, so no
+        // per-element index recomputation happens at all. The innermost
+        // extent is handled as one contiguous run (operand strides there are
+        // 0 or 1), so the data-dependent carry branch fires once per row
+        // rather than once per element.
         std::vector<int> stride1 = fetchStride(dat1);
         std::vector<int> stride2 = fetchStride(dat2);
-        std::vector<int> strideOut = fetchStride(out);
+        int shift1 = out.ndim() - dat1.ndim();
+        int shift2 = out.ndim() - dat2.ndim();
+        std::vector<int> bstride1(out.ndim(), 0), bstride2(out.ndim(), 0);
+        for (int dim = 0; dim < out.ndim(); ++dim) {
+            if (dim >= shift1 && dat1.tensorSize[dim - shift1] != 1)
+                bstride1[dim] = stride1[dim - shift1];
+            if (dim >= shift2 && dat2.tensorSize[dim - shift2] != 1)
+                bstride2[dim] = stride2[dim - shift2];
+        }
 
-        for (int idx = 0; idx < out.numel; ++idx) {
-            int idx1 = getIndex(indices, dat1.tensorSize, stride1);
-            int idx2 = getIndex(indices, dat2.tensorSize, stride2);
+        int innerN = out.tensorSize.back();
+        int is1 = bstride1[out.ndim() - 1];
+        int is2 = bstride2[out.ndim() - 1];
+
+#ifdef _OPENMP
+        // Outer-dim slabs write disjoint output ranges, so they parallelize
+        // cleanly; each worker seeds its own odometer at its slab start.
+        int outerN = out.ndim() > 1 ? out.tensorSize[0] : 1;
+        if (configuredThreads() > 1 && outerN > 1 && out.numel >= (1 << 16)) {
+            long long chunk = out.numel / outerN;
+#pragma omp parallel for num_threads(configuredThreads()) schedule(static)
+            for (int outerIdx = 0; outerIdx < outerN; ++outerIdx) {
+                std::vector<int> indices(out.ndim(), 0);
+                int idx1 = outerIdx * bstride1[0], idx2 = outerIdx * bstride2[0];
+                const long long base = outerIdx * chunk;
+                for (long long idx = 0; idx < chunk; idx += innerN) {
+                    for (int j = 0; j < innerN; ++j) {
+                        out.rawData[base + idx + j] = op(dat1.rawData[idx1 + j * is1], dat2.rawData[idx2 + j * is2]);
+                    }
+
+                    for (int dim = out.ndim() - 2; dim >= 1; --dim) {
+                        indices[dim]++;
+                        idx1 += bstride1[dim];
+                        idx2 += bstride2[dim];
+                        if (indices[dim] < out.tensorSize[dim]) {
+                            break;
+                        }
+                        indices[dim] = 0;
+                        idx1 -= bstride1[dim] * out.tensorSize[dim];
+                        idx2 -= bstride2[dim] * out.tensorSize[dim];
+                    }
+                }
+            }
+            return out;
+        }
+#endif
 
-            out.rawData[idx] = op(dat1.rawData[idx1], dat2.rawData[idx2]);
+        std::vector<int> indices(out.ndim(), 0);
+        int idx1 = 0, idx2 = 0;
+        for (long long idx = 0; idx < out.numel; idx += innerN) {
+            for (int j = 0; j < innerN; ++j) {
+                out.rawData[idx + j] = op(dat1.rawData[idx1 + j * is1], dat2.rawData[idx2 + j * is2]);
+            }
 
-            // Update indices for broadcasting
-            for (int dim = indices.size() - 1; dim >= 0; --dim) {
+            for (int dim = out.ndim() - 2; dim >= 0; --dim) {
                 indices[dim]++;
+                idx1 += bstride1[dim];
+                idx2 += bstride2[dim];
                 if (indices[dim] < out.tensorSize[dim]) {
                     break;
                 }
                 indices[dim] = 0;
+                idx1 -= bstride1[dim] * out.tensorSize[dim];
+                idx2 -= bstride2[dim] * out.tensorSize[dim];
             }
         }
 
@@ -313,17 +930,77 @@ class TensorMeta {
      * @brief Returns the shape of the tensor.
      * @return The shape of the tensor.
      */
-    std::vector<int> shape() { return tensorSize; }
+    const std::vector<int>& shape() const { return tensorSize; }
 
 #pragma region ArithMaticOperators
 
+    /**
+     * @brief Checks whether other broadcasts as a vector over this tensor's rows.
+     *
+     * True for the bias-add family: this is (..., N) and other is (N,), so the
+     * combination is one contiguous kernel call per row. The ndim guard keeps
+     * the result shape equal to this tensor's shape, and N must be a multiple
+     * of eight doubles so every row base stays on the cache line the aligned
+     * kernel loads expect.
+     *
+     * @param other The candidate vector operand.
+     * @return Whether the row-wise fast path applies.
+     */
+    bool rowBroadcastable(const TensorMeta& other) const {
+        return ndim() > 1 && other.ndim() == 1 && other.numel > 1 && (other.numel & 7) == 0 &&
+               tensorSize.back() == other.tensorSize[0];
+    }
+
+    /**
+     * @brief Applies a binary SIMD kernel between each trailing row and a vector.
+     *
+     * Routes the (..., N) op (N,) pattern around the broadcast odometer: every
+     * output row is one contiguous kernel sweep over the shared vector.
+     *
+     * @param vec The trailing-dimension vector operand.
+     * @param kernel The binary SIMD kernel to apply per row.
+     * @param vecOnLeft Whether the vector is the kernel's left operand.
+     * @return A new tensor of this tensor's shape.
+     */
+    TensorMeta rowwiseOp(const TensorMeta& vec, void (*kernel)(const double*, const double*, double*, size_t),
+                         bool vecOnLeft) const {
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        const long long n = vec.numel;
+        for (long long row = 0; row < numel; row += n) {
+            if (vecOnLeft) {
+                kernel(vec.rawData.data(), rawData.data() + row, out.rawData.data() + row, n);
+            } else {
+                kernel(rawData.data() + row, vec.rawData.data(), out.rawData.data() + row, n);
+            }
+        }
+        return out;
+    }
+
     /**
      * @brief Computes the element-wise/broadcastabed addition of two tensors.
      * @param other The other tensor.
      * @return A new tensor with the result of the addition.
      */
     TensorMeta operator+(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 + val2; };
+        if (tensorSize == other.tensorSize) {
+            // Same-shape fast path: contiguous SIMD sweep, no index machinery.
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecAddF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        if (other.numel == 1 && other.ndim() <= ndim()) {
+            return *this + other.rawData[0];
+        }
+        if (numel == 1 && ndim() <= other.ndim()) {
+            return other + rawData[0];
+        }
+        if (rowBroadcastable(other)) {
+            return rowwiseOp(other, vecAddF64, false);
+        }
+        if (other.rowBroadcastable(*this)) {
+            return other.rowwiseOp(*this, vecAddF64, false);
+        }
+        auto op = [](double val1, double val2) { return val1 + val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
@@ -333,9 +1010,9 @@ class TensorMeta {
      * @return A new tensor with the result of the addition.
      */
     TensorMeta operator+(double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 + val2; };
-        TensorMeta otherMeta = TensorMeta({other}, {1});
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecAddScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
     }
 
     /**
@@ -345,8 +1022,49 @@ class TensorMeta {
      * @return A reference to the current tensor.
      * @throws std::runtime_error if the shapes are not compatible.
      */
+    /**
+     * @brief Fused accumulate: this[i] += x[i] * y[i] in one streaming pass.
+     *
+     * Backward edges of multiplicative ops previously materialized x*y into a
+     * temporary and then added it - two full sweeps plus an allocation. All
+     * three tensors must share one shape.
+     *
+     * @param x The first factor.
+     * @param y The second factor.
+     */
+    void axpy(const TensorMeta& x, const TensorMeta& y) {
+        vecFmaddF64(x.rawData.data(), y.rawData.data(), rawData.data(), rawData.size());
+    }
+
+    /**
+     * @brief Fused multiply-add: returns a * b + c in one streaming pass.
+     *
+     * Writing a * b + c with the operators reads and writes four tensors
+     * (the product temporary is materialized and re-read); the fused form
+     * touches three and uses hardware FMA. Shapes that do not all match
+     * fall back to the operator chain with its broadcasting.
+     *
+     * @param a The first factor.
+     * @param b The second factor.
+     * @param c The addend.
+     * @return A new tensor holding a * b + c.
+     */
+    static TensorMeta fma(const TensorMeta& a, const TensorMeta& b, const TensorMeta& c) {
+        if (a.tensorSize == b.tensorSize && a.tensorSize == c.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(a.tensorSize);
+            vecFmaF64(a.rawData.data(), b.rawData.data(), c.rawData.data(), out.rawData.data(), out.rawData.size());
+            return out;
+        }
+        return a * b + c;
+    }
+
     TensorMeta& operator+=(const TensorMeta& other) {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 + val2; };
+        if (tensorSize == other.tensorSize) {
+            // Accumulate in place; no temporary at all on the same-shape path.
+            vecAddF64(rawData.data(), other.rawData.data(), rawData.data(), rawData.size());
+            return *this;
+        }
+        auto op = [](double val1, double val2) { return val1 + val2; };
         *this = std::move(TensorMeta::broadcast(*this, other, op));
         return *this;
     }
@@ -355,10 +1073,10 @@ class TensorMeta {
      * @brief Computes the element-wise/broadcastabed negation of the tensor.
      * @return A new tensor with the result of the negation.
      */
-    TensorMeta operator-() {
-        TensorMeta other({0}, {1});
-        std::function<double(double, double)> op = [](double val1, double val2) { return val2 - val1; };
-        return TensorMeta::broadcast(*this, other, op);
+    TensorMeta operator-() const {
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecMulScalarF64(rawData.data(), -1.0, out.rawData.data(), rawData.size());
+        return out;
     }
 
     /**
@@ -367,7 +1085,21 @@ class TensorMeta {
      * @return A new tensor with the result of the subtraction.
      */
     TensorMeta operator-(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 - val2; };
+        if (tensorSize == other.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecSubF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        if (other.numel == 1 && other.ndim() <= ndim()) {
+            return *this - other.rawData[0];
+        }
+        if (rowBroadcastable(other)) {
+            return rowwiseOp(other, vecSubF64, false);
+        }
+        if (other.rowBroadcastable(*this)) {
+            return other.rowwiseOp(*this, vecSubF64, true);
+        }
+        auto op = [](double val1, double val2) { return val1 - val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
@@ -378,9 +1110,9 @@ class TensorMeta {
      * @throws std::runtime_error if the shapes are not compatible.
      */
     TensorMeta operator-(double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 - val2; };
-        TensorMeta otherMeta = TensorMeta({other}, {1});
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecSubScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
     }
 
     /**
@@ -391,7 +1123,11 @@ class TensorMeta {
      * @throws std::runtime_error if the shapes are not compatible.
      */
     TensorMeta& operator-=(const TensorMeta& other) {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 - val2; };
+        if (tensorSize == other.tensorSize) {
+            vecSubF64(rawData.data(), other.rawData.data(), rawData.data(), rawData.size());
+            return *this;
+        }
+        auto op = [](double val1, double val2) { return val1 - val2; };
         *this = std::move(TensorMeta::broadcast(*this, other, op));
         return *this;
     }
@@ -402,7 +1138,24 @@ class TensorMeta {
      * @return A new tensor with the result of the multiplication.
      */
     TensorMeta operator*(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 * val2; };
+        if (tensorSize == other.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecMulF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        if (other.numel == 1 && other.ndim() <= ndim()) {
+            return *this * other.rawData[0];
+        }
+        if (numel == 1 && ndim() <= other.ndim()) {
+            return other * rawData[0];
+        }
+        if (rowBroadcastable(other)) {
+            return rowwiseOp(other, vecMulF64, false);
+        }
+        if (other.rowBroadcastable(*this)) {
+            return other.rowwiseOp(*this, vecMulF64, false);
+        }
+        auto op = [](double val1, double val2) { return val1 * val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
@@ -412,25 +1165,73 @@ class TensorMeta {
      * @return A new tensor with the result of the multiplication.
      */
     TensorMeta operator*(const double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 * val2; };
-        TensorMeta otherMeta = TensorMeta(other);
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecMulScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
+    }
+
+    /**
+     * @brief Computes the element-wise/broadcastabed multiplication of two tensors and assigns the result to the first
+     * tensor.
+     * @param other The other tensor.
+     * @return A reference to the current tensor.
+     * @throws std::runtime_error if the shapes are not compatible.
+     */
+    TensorMeta& operator*=(const TensorMeta& other) {
+        if (tensorSize == other.tensorSize) {
+            vecMulF64(rawData.data(), other.rawData.data(), rawData.data(), rawData.size());
+            return *this;
+        }
+        auto op = [](double val1, double val2) { return val1 * val2; };
+        *this = std::move(TensorMeta::broadcast(*this, other, op));
+        return *this;
     }
 
     TensorMeta operator/(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 / val2; };
+        if (tensorSize == other.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecDivF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        if (other.numel == 1 && other.ndim() <= ndim()) {
+            return *this / other.rawData[0];
+        }
+        if (rowBroadcastable(other)) {
+            return rowwiseOp(other, vecDivF64, false);
+        }
+        if (other.rowBroadcastable(*this)) {
+            return other.rowwiseOp(*this, vecDivF64, true);
+        }
+        auto op = [](double val1, double val2) { return val1 / val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
+    /**
+     * @brief Computes the element-wise/broadcastabed division of two tensors and assigns the result to the first
+     * tensor.
+     * @param other The other tensor.
+     * @return A reference to the current tensor.
+     * @throws std::runtime_error if the shapes are not compatible.
+     */
+    TensorMeta& operator/=(const TensorMeta& other) {
+        if (tensorSize == other.tensorSize) {
+            vecDivF64(rawData.data(), other.rawData.data(), rawData.data(), rawData.size());
+            return *this;
+        }
+        auto op = [](double val1, double val2) { return val1 / val2; };
+        *this = std::move(TensorMeta::broadcast(*this, other, op));
+        return *this;
+    }
+
     /**
      * @brief Computes the element-wise/broadcastabed/broadcastabed division of a tensor and a scalar.
      * @param other The scalar value.
      * @return A new tensor with the result of the division.
      */
     TensorMeta operator/(double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 / val2; };
-        TensorMeta otherMeta = TensorMeta(other);
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecDivScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
     }
 
     /**
@@ -440,7 +1241,12 @@ class TensorMeta {
      * @throws std::runtime_error if the shapes are not compatible.
      */
     TensorMeta operator>(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 > val2; };
+        if (tensorSize == other.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecCmpGtF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        auto op = [](double val1, double val2) { return val1 > val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
@@ -450,9 +1256,9 @@ class TensorMeta {
      * @return A new tensor with the result of the operation.
      */
     TensorMeta operator>(double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 > val2; };
-        TensorMeta otherMeta = TensorMeta(other);
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecCmpGtScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
     }
 
     /**
@@ -461,7 +1267,12 @@ class TensorMeta {
      * @return A new tensor with the result of the operation.
      */
     TensorMeta operator>=(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 >= val2; };
+        if (tensorSize == other.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecCmpGeF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        auto op = [](double val1, double val2) { return val1 >= val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
@@ -471,9 +1282,9 @@ class TensorMeta {
      * @return A new tensor with the result of the operation.
      */
     TensorMeta operator>=(double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 >= val2; };
-        TensorMeta otherMeta = TensorMeta(other);
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecCmpGeScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
     }
 
     /**
@@ -482,7 +1293,12 @@ class TensorMeta {
      * @return A new tensor with the result of the operation.
      */
     TensorMeta operator<(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 < val2; };
+        if (tensorSize == other.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecCmpLtF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        auto op = [](double val1, double val2) { return val1 < val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
@@ -492,9 +1308,9 @@ class TensorMeta {
      * @return A new tensor with the result of the operation.
      */
     TensorMeta operator<(double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 < val2; };
-        TensorMeta otherMeta = TensorMeta(other);
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecCmpLtScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
     }
 
     /**
@@ -503,7 +1319,12 @@ class TensorMeta {
      * @return A new tensor with the result of the operation.
      */
     TensorMeta operator<=(const TensorMeta& other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 <= val2; };
+        if (tensorSize == other.tensorSize) {
+            TensorMeta out = TensorMeta::uninit(tensorSize);
+            vecCmpLeF64(rawData.data(), other.rawData.data(), out.rawData.data(), rawData.size());
+            return out;
+        }
+        auto op = [](double val1, double val2) { return val1 <= val2; };
         return TensorMeta::broadcast(*this, other, op);
     }
 
@@ -513,15 +1334,55 @@ class TensorMeta {
      * @return A new tensor with the result of the operation.
      */
     TensorMeta operator<=(double other) const {
-        std::function<double(double, double)> op = [](double val1, double val2) { return val1 <= val2; };
-        TensorMeta otherMeta = TensorMeta(other);
-        return TensorMeta::broadcast(*this, otherMeta, op);
+        TensorMeta out = TensorMeta::uninit(tensorSize);
+        vecCmpLeScalarF64(rawData.data(), other, out.rawData.data(), rawData.size());
+        return out;
     }
 
+    /**
+     * @brief Computes the element-wise power of the tensor to a scalar exponent.
+     *
+     * The exponent is a plain double, so this is a unary sweep: no dummy
+     * scalar tensor and no broadcast machinery on the way to std::pow.
+     *
+     * @param meta The input tensor.
+     * @param power The exponent.
+     * @return A tensor with each element raised to the exponent.
+     */
     static TensorMeta pow(const TensorMeta& meta, double power) {
-        TensorMeta other(power);
-        std::function<double(double, double)> op = [](double val1, double val2) { return std::pow(val1, val2); };
-        return TensorMeta::broadcast(meta, other, op);
+        TensorMeta out = TensorMeta::uninit(meta.tensorSize);
+        const double* src = meta.rawData.data();
+        double* dst = out.rawData.data();
+        const size_t n = out.rawData.size();
+        // Common exponents skip the generic std::pow routine: squaring reuses
+        // the SIMD multiply kernel, small integer powers unroll into plain
+        // multiplies, and sqrt/reciprocal map to single instructions.
+        if (power == 2.0) {
+            vecMulF64(src, src, dst, n);
+        } else if (power == 0.5) {
+            for (size_t idx = 0; idx < n; ++idx) {
+                dst[idx] = std::sqrt(src[idx]);
+            }
+        } else if (power == -1.0) {
+            for (size_t idx = 0; idx < n; ++idx) {
+                dst[idx] = 1.0 / src[idx];
+            }
+        } else if (std::trunc(power) == power && std::fabs(power) < 32.0) {
+            const int reps = int(std::fabs(power));
+            const bool recip = power < 0.0;
+            for (size_t idx = 0; idx < n; ++idx) {
+                double acc = 1.0;
+                for (int rep = 0; rep < reps; ++rep) {
+                    acc *= src[idx];
+                }
+                dst[idx] = recip ? 1.0 / acc : acc;
+            }
+        } else {
+            for (size_t idx = 0; idx < n; ++idx) {
+                dst[idx] = std::pow(src[idx], power);
+            }
+        }
+        return out;
     }
 
     /**
@@ -530,9 +1391,9 @@ class TensorMeta {
      * @return A tensor with exponentiated values.
      */
     static TensorMeta exp(const TensorMeta& meta) {
-        TensorMeta other(1);
-        std::function<double(double, double)> op = [](double val1, double val2) { return std::exp(val1); };
-        return TensorMeta::broadcast(meta, other, op);
+        TensorMeta out = TensorMeta::uninit(meta.tensorSize);
+        expKernel(meta.rawData.data(), out.rawData.data(), out.rawData.size());
+        return out;
     }
 
     /**
@@ -541,9 +1402,9 @@ class TensorMeta {
      * @return A tensor with absolute values.
      */
     static TensorMeta abs(const TensorMeta& meta) {
-        TensorMeta other(1);
-        std::function<double(double, double)> op = [](double val1, double val2) { return std::abs(val1); };
-        return TensorMeta::broadcast(meta, other, op);
+        TensorMeta out = TensorMeta::uninit(meta.tensorSize);
+        vecAbsF64(meta.rawData.data(), out.rawData.data(), out.rawData.size());
+        return out;
     }
 
     /**
@@ -597,19 +1458,14 @@ class TensorMeta {
             if (v1[dim1 - 1] != v2[dim2 - 2])
                 return false;
             std::vector<int> v1Part(v1.begin(), v1.end() - 2), v2Part(v2.begin(), v2.end() - 2);
-            try {
-                if (!v1Part.size())
-                    v1Part = {1};
-                if (!v2Part.size())
-                    v2Part = {1};
-                // If broadcastable
-                std::vector<int> bcSize = fetchBroadcastedSize(v1Part, v2Part);
-                return true;
-            } catch (const std::exception& e) {
-                // If not broadcastable
-                std::cerr << e.what() << std::endl;
-                return false;
-            }
+            if (!v1Part.size())
+                v1Part = {1};
+            if (!v2Part.size())
+                v2Part = {1};
+            // Valid exactly when the batch dims broadcast; the probe reports
+            // that through its return value, no exception round trip.
+            std::vector<int> bcSize;
+            return tryFetchBroadcastedSize(v1Part, v2Part, bcSize);
         }
     }
 
@@ -662,7 +1518,7 @@ class TensorMeta {
      * @param K Number of columns in A and rows in B.
      * @param N Number of columns in B and output matrix.
      */
-    static void matmulAtomic(const std::vector<double>& A, const std::vector<double>& B, std::vector<double>& out,
+    static void matmulAtomic(const AlignedVector& A, const AlignedVector& B, AlignedVector& out,
                              int offSetA, int offSetB, int offSetOut, int M, int K, int N) {
         // A ->   M x K
         // B ->   K x N
@@ -675,21 +1531,34 @@ class TensorMeta {
     }
 
     /**
-     * @brief Computes the batch index offset for a given batch shape and strides.
-     * @param shape Shape of the tensor.
-     * @param stride Stride of the tensor.
-     * @param indices Batch indices to compute offset.
-     * @return The computed offset for the batch index.
+     * @brief 2-D matmul with optional operand transposes, no materialized copies.
+     *
+     * The backward pass of matmul needs dA = dC . B^T and dB = A^T . dC;
+     * materializing those transposes copies a full matrix each per step.
+     * cblas_dgemm accepts transpose flags directly and reads the original
+     * buffer with swapped strides, so the copies disappear entirely.
+     *
+     * @param dat1 First matrix.
+     * @param dat2 Second matrix.
+     * @param transA Whether to multiply with the first matrix transposed.
+     * @param transB Whether to multiply with the second matrix transposed.
+     * @return The resulting matrix.
+     * @throws std::runtime_error If the inner dimensions are inconsistent.
      */
-    static int getMatmulBatchIndex(const std::vector<int>& shape, const std::vector<int>& stride,
-                                   const std::vector<int>& indices) {
-        int offSet = 0;
-        int dimShift = indices.size() - shape.size() + 2;
-        // for(int idx=0;idx<shape.size()-2;++idx)
-        for (int idx = 0; idx < shape.size() - 2; ++idx) {
-            offSet += (shape[idx] == 1) ? 0 : indices[idx + dimShift] * stride[idx];
-        }
-        return offSet;
+    static TensorMeta matmulTrans(const TensorMeta& dat1, const TensorMeta& dat2, bool transA, bool transB) {
+        assert(dat1.ndim() == 2 && dat2.ndim() == 2 && "matmulTrans expects 2-D operands!");
+        int M = transA ? dat1.tensorSize[1] : dat1.tensorSize[0];
+        int K = transA ? dat1.tensorSize[0] : dat1.tensorSize[1];
+        int Kb = transB ? dat2.tensorSize[1] : dat2.tensorSize[0];
+        int N = transB ? dat2.tensorSize[0] : dat2.tensorSize[1];
+        if (K != Kb)
+            throw std::runtime_error("Inconsistent data dimension, unable to perform matmul!");
+
+        TensorMeta out = TensorMeta::uninit({M, N});
+        cblas_dgemm(CblasRowMajor, transA ? CblasTrans : CblasNoTrans, transB ? CblasTrans : CblasNoTrans, M, N, K,
+                    1.0, dat1.rawData.data(), dat1.tensorSize[1], dat2.rawData.data(), dat2.tensorSize[1], 0.0,
+                    out.rawData.data(), N);
+        return out;
     }
 
     /**
@@ -700,7 +1569,7 @@ class TensorMeta {
      */
     static TensorMeta matmulBroadcast(const TensorMeta& dat1, const TensorMeta& dat2) {
         std::vector<int> outShape = fetchMatmulSize(dat1, dat2);
-        TensorMeta out(outShape);
+        TensorMeta out = TensorMeta::uninit(outShape);
 
         int batchSize = 1;
         for (int dimIdx = 0; dimIdx < out.ndim() - 2; ++dimIdx) {
@@ -711,29 +1580,79 @@ class TensorMeta {
         int N = outShape[outShape.size() - 1];
         int K = dat1.tensorSize.back();
 
+        // One shared RHS against a full contiguous LHS batch is a single
+        // (batch*M, K) x (K, N) product: the stacked A blocks are adjacent in
+        // memory, so one GEMM call covers every batch and BLAS does its cache
+        // blocking (and threading) once instead of per batch.
+        bool rhsShared = true;
+        for (int dimIdx = 0; dimIdx < dat2.ndim() - 2; ++dimIdx) {
+            rhsShared &= dat2.tensorSize[dimIdx] == 1;
+        }
+        bool lhsFullBatch = dat1.ndim() == out.ndim();
+        for (int dimIdx = 0; lhsFullBatch && dimIdx < out.ndim() - 2; ++dimIdx) {
+            lhsFullBatch &= dat1.tensorSize[dimIdx] == out.tensorSize[dimIdx];
+        }
+        if (rhsShared && lhsFullBatch) {
+            matmulAtomic(dat1.rawData, dat2.rawData, out.rawData, 0, 0, 0, batchSize * M, K, N);
+            return out;
+        }
+
         std::vector<int> stride1 = fetchStride(dat1);
         std::vector<int> stride2 = fetchStride(dat2);
-        std::vector<int> strideOut = fetchStride(out);
 
-        std::vector<int> indices(outShape.size() - 2, 0);
+        // Per-batch-dim operand steps, zero where that operand is broadcast.
+        // The offsets are then carried incrementally by the odometer - O(1)
+        // per batch instead of a fresh multiply-add walk over the prefix
+        // dims. One pass collects them all, so the GEMM loop below stays
+        // carry-free and each call independent.
+        int batchDims = int(outShape.size()) - 2;
+        int shift1 = batchDims - (dat1.ndim() - 2);
+        int shift2 = batchDims - (dat2.ndim() - 2);
+        std::vector<int> batchStep1(batchDims, 0), batchStep2(batchDims, 0);
+        for (int dim = 0; dim < batchDims; ++dim) {
+            if (dim >= shift1 && dat1.tensorSize[dim - shift1] != 1)
+                batchStep1[dim] = stride1[dim - shift1];
+            if (dim >= shift2 && dat2.tensorSize[dim - shift2] != 1)
+                batchStep2[dim] = stride2[dim - shift2];
+        }
 
+        std::vector<int> indices(batchDims, 0);
+        std::vector<int> offSets1(batchSize), offSets2(batchSize);
+        int off1 = 0, off2 = 0;
         for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx) {
-            int offSet1 = getMatmulBatchIndex(dat1.tensorSize, stride1, indices);
-            int offSet2 = getMatmulBatchIndex(dat2.tensorSize, stride2, indices);
-            int offSetOut = batchIdx * (M * N);
-
-            matmulAtomic(dat1.rawData, dat2.rawData, out.rawData, offSet1, offSet2, offSetOut, M, K, N);
+            offSets1[batchIdx] = off1;
+            offSets2[batchIdx] = off2;
 
-            // Update indices for broadcasting
-            for (int dim = indices.size() - 1; dim >= 0; --dim) {
+            for (int dim = batchDims - 1; dim >= 0; --dim) {
                 indices[dim]++;
+                off1 += batchStep1[dim];
+                off2 += batchStep2[dim];
                 if (indices[dim] < outShape[dim]) {
                     break;
                 }
                 indices[dim] = 0;
+                off1 -= batchStep1[dim] * outShape[dim];
+                off2 -= batchStep2[dim] * outShape[dim];
             }
         }
 
+        // Tiny per-batch products are dominated by BLAS dispatch cost rather
+        // than arithmetic; route those through the register-blocked small
+        // kernel and keep dgemm for batches with real work in them.
+        const bool smallGemm = M * N * K <= 4096;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(configuredThreads()) schedule(static) if (configuredThreads() > 1 && batchSize > 1)
+#endif
+        for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx) {
+            if (smallGemm)
+                matmulSmallF64(dat1.rawData.data() + offSets1[batchIdx], dat2.rawData.data() + offSets2[batchIdx],
+                               out.rawData.data() + batchIdx * (M * N), M, K, N);
+            else
+                matmulAtomic(dat1.rawData, dat2.rawData, out.rawData, offSets1[batchIdx], offSets2[batchIdx],
+                             batchIdx * (M * N), M, K, N);
+        }
+
         return out;
     }
 
@@ -753,20 +1672,10 @@ class TensorMeta {
         int dim1 = dat1.ndim(), dim2 = dat2.ndim();
 
         if (dim1 == 1 && dim2 == 1) {
-            // Performing Dot Product
-
-            // A -> (M, ) , B -> (M, )
-            // A -> (1, 1, M), B -> (1, M, 1)
-            TensorMeta dat1Brodcasted = dat1.unsqueeze().unsqueeze();
-            TensorMeta dat2Broadcasted = dat2.unsqueeze(1).unsqueeze();
-
-            // Perform MatMul
-            // Out -> (1, 1, 1)
-            TensorMeta out = matmulBroadcast(dat1Brodcasted, dat2Broadcasted);
-
-            // Out -> (1,)
-            out = out.squeeze(2).squeeze();
-            return out;
+            // Dot product straight through ddot: spinning up a (1,1,M) x
+            // (1,M,1) GEMM to produce one scalar costs more in dispatch and
+            // unsqueeze/squeeze copies than the reduction itself.
+            return TensorMeta(cblas_ddot(dat1.tensorSize[0], dat1.rawData.data(), 1, dat2.rawData.data(), 1));
         } else if (dim1 == 2 && dim2 == 2) {
             // Expanding last dimension to perform batched matmul
             // A -> (M, K), B -> (K, N)
@@ -775,7 +1684,7 @@ class TensorMeta {
             TensorMeta out = matmul(dat1.unsqueeze(), dat2.unsqueeze());
 
             // Out -> (M, N)
-            return out.squeeze();
+            return std::move(out).squeeze();
         } else if (dim1 == 1 && dim2 == 2) {
             // A -> (M, ) , B -> (M, K)
             // A -> (1, M), B -> (M, K)(unchanged)
@@ -783,7 +1692,7 @@ class TensorMeta {
             TensorMeta out = matmul(dat1.unsqueeze(), dat2);
 
             // Out -> (K,)
-            return out.squeeze();
+            return std::move(out).squeeze();
         } else if (dim1 == 2 && dim2 == 1) {
             // A -> (M, K) , B -> (K, )
             // A -> (M, K)(unchanged), B -> (K, 1)
@@ -791,7 +1700,7 @@ class TensorMeta {
             TensorMeta out = matmul(dat1, dat2.unsqueeze(1));
 
             // Out -> (M,)
-            return out.squeeze(1);
+            return std::move(out).squeeze(1);
         } else {
             if (dim1 == 1) {
                 // A -> (M, ) , B -> (..., M, K)
@@ -800,7 +1709,7 @@ class TensorMeta {
                 // Out -> (..., 1, K)
                 TensorMeta out = matmulBroadcast(dat1Brodcasted, dat2);
                 // Out -> (..., K)
-                return out.squeeze(out.ndim() - 2);
+                return std::move(out).squeeze(out.ndim() - 2);
             } else if (dim1 == 2) {
                 // A -> (M, K), B -> (..., K, N)
                 // A -> (1, M, K)
@@ -814,7 +1723,7 @@ class TensorMeta {
                 // Out -> (..., M, 1)
                 TensorMeta out = matmulBroadcast(dat1, dat2Brodcasted);
                 // Out -> (..., M)
-                return out.squeeze(out.ndim() - 1);
+                return std::move(out).squeeze(out.ndim() - 1);
             } else if (dim2 == 2) {
                 // A -> (..., M, K), B -> (K, N)
                 // B -> (1, K, N)
@@ -842,17 +1751,21 @@ class TensorMeta {
         if (!axis.size()) {
             return {1};
         }
-        std::set<int> axes(axis.begin(), axis.end());
-        std::vector<int> finShape(origShape.begin(), origShape.end());
-        std::set<int>::reverse_iterator it;
-        for (it = axes.rbegin(); it != axes.rend(); ++it) {
-            int dim = *it;
-            if (dim < origShape.size() && dim >= 0) {
-                if (keepdims) {
-                    finShape[dim] = 1;
-                } else {
-                    finShape.erase(finShape.begin() + dim);
-                }
+        // Rank is tiny, so the axis set is a bitmask: no tree allocation, no
+        // reverse-iterator walk, and duplicate axes collapse for free.
+        uint32_t axisMask = 0;
+        for (int dim : axis) {
+            if (dim >= 0 && dim < int(origShape.size()))
+                axisMask |= uint32_t(1) << dim;
+        }
+        std::vector<int> finShape;
+        finShape.reserve(origShape.size());
+        for (int dim = 0; dim < int(origShape.size()); ++dim) {
+            if (axisMask & (uint32_t(1) << dim)) {
+                if (keepdims)
+                    finShape.push_back(1);
+            } else {
+                finShape.push_back(origShape[dim]);
             }
         }
         if (finShape.empty())
@@ -861,35 +1774,6 @@ class TensorMeta {
         return finShape;
     }
 
-    /**
-     * @brief Performs atomic summation while considering squeezed dimensions.
-     * @param indices Indices of the base tensor.
-     * @param baseMeta Input tensor data.
-     * @param outMeta Output tensor data.
-     * @param baseShape Shape of the input tensor.
-     * @param baseStride Stride of the input tensor.
-     * @param outShape Shape of the output tensor.
-     * @param outStride Stride of the output tensor.
-     * @param axis Axes along which to sum.
-     * @param keepdims If true, retains reduced dimensions as size 1.
-     */
-    void squeezedSumAtomic(const std::vector<int>& indices, const std::vector<double>& baseMeta,
-                           std::vector<double>& outMeta, const std::vector<int>& baseShape,
-                           const std::vector<int>& baseStride, const std::vector<int>& outShape,
-                           const std::vector<int>& outStride, const std::vector<int>& axis, bool keepdims = false) {
-        // Fetch output indices
-        std::vector<int> outIndices = indices;
-        if (!keepdims)
-            outIndices = fetchSqueezedShape(indices, axis);
-
-        // Find actual indices in flattened data
-        int baseIdx = getIndex(indices, baseShape, baseStride);
-        int outIdx = getIndex(outIndices, outShape, outStride);
-
-        //  In place Sum Operation
-        outMeta[outIdx] += baseMeta[baseIdx];
-    }
-
     /**
      * @brief Determines the broadcasted axes when expanding one tensor to match another.
      * @param base Original tensor metadata.
@@ -958,20 +1842,93 @@ class TensorMeta {
      * @param initVal The initial value for the reduction operation.
      * @return A new TensorMeta object representing the reduced tensor.
      */
-    static TensorMeta reduce(const TensorMeta& meta, std::vector<int> axis, std::function<double(double, double)> op,
-                             bool keepDims = false, double initVal = 0) {
-        // If no axis specified then perform on the whole data
+    template <typename Op>
+    static TensorMeta reduce(const TensorMeta& meta, std::vector<int> axis, Op&& op, bool keepDims = false,
+                             double initVal = 0) {
+        // If no axis specified then perform on the whole data: one linear
+        // sweep into a scalar, no axis-list or stride scratch needed.
         if (axis.size() == 0) {
-            axis = arange(0, meta.ndim());
+            double acc = initVal;
+            for (long long idx = 0; idx < meta.numel; ++idx) {
+                acc = op(acc, meta.rawData[idx]);
+            }
+            TensorMeta out = TensorMeta::uninit(keepDims ? std::vector<int>(meta.ndim(), 1) : std::vector<int>{1});
+            out.rawData[0] = acc;
+            return out;
+        }
+        if (axis.size() == 1) {
+            return reduceSingle(meta, axis[0], op, keepDims, initVal);
         }
-        TensorMeta out = meta;
-        sort(axis.rbegin(), axis.rend());
-        for (auto dim : axis) {
-            out = reduceSingle(out, dim, op, keepDims, initVal);
+
+        // Multiple axes fuse into one sweep: reducing them one at a time
+        // would allocate and re-read an intermediate tensor per axis. The
+        // output keeps reduced dims at extent 1 during the walk so source
+        // and output ranks line up, then drops them at the end if asked.
+        std::vector<int> keptShape = meta.tensorSize;
+        for (int dim : axis) {
+            keptShape[dim] = 1;
+        }
+        TensorMeta out = TensorMeta::uninit(keptShape);
+        out.updateAll(initVal);
+        reduceInto(meta, out, op);
+        if (!keepDims) {
+            return TensorMeta::fromRaw(std::move(out.rawData), fetchSqueezedShape(meta.tensorSize, axis, false));
         }
         return out;
     }
 
+    /**
+     * @brief Applies a reduction into a same-rank destination in one pass.
+     *
+     * Generic-op sibling of reduceIntoShape: axes the destination holds at
+     * extent 1 contribute stride 0 to the output index, which the odometer
+     * carry loop maintains incrementally. The innermost run is hoisted - a
+     * reduced inner axis folds into a local before one store, a kept one is
+     * a straight element loop - so the carry fires once per row.
+     *
+     * @param src The source tensor.
+     * @param dst The pre-initialized destination; same rank as the source
+     * with reduced axes at extent 1.
+     * @param op A binary function defining the reduction operation.
+     */
+    template <typename Op>
+    static void reduceInto(const TensorMeta& src, TensorMeta& dst, Op&& op) {
+        std::vector<int> outStride = fetchStride(dst.tensorSize);
+        std::vector<int> contrib(src.ndim(), 0);
+        for (int dim = 0; dim < src.ndim(); ++dim) {
+            bool reduced = (dst.tensorSize[dim] == 1 && src.tensorSize[dim] != 1);
+            contrib[dim] = reduced ? 0 : outStride[dim];
+        }
+
+        int innerN = src.tensorSize.back();
+        int innerC = contrib[src.ndim() - 1];
+        std::vector<int> indices(src.ndim(), 0);
+        int outIdx = 0;
+        for (long long idx = 0; idx < src.numel; idx += innerN) {
+            if (innerC == 0) {
+                double acc = dst.rawData[outIdx];
+                for (int j = 0; j < innerN; ++j) {
+                    acc = op(acc, src.rawData[idx + j]);
+                }
+                dst.rawData[outIdx] = acc;
+            } else {
+                for (int j = 0; j < innerN; ++j) {
+                    dst.rawData[outIdx + j] = op(dst.rawData[outIdx + j], src.rawData[idx + j]);
+                }
+            }
+
+            for (int dim = src.ndim() - 2; dim >= 0; --dim) {
+                indices[dim]++;
+                outIdx += contrib[dim];
+                if (indices[dim] < src.tensorSize[dim]) {
+                    break;
+                }
+                indices[dim] = 0;
+                outIdx -= contrib[dim] * src.tensorSize[dim];
+            }
+        }
+    }
+
     /**
      * @brief Performs reduction along a single axis.
      *
@@ -985,32 +1942,231 @@ class TensorMeta {
      * @param initVal The initial value for the reduction operation.
      * @return A new TensorMeta object representing the reduced tensor.
      */
-    static TensorMeta reduceSingle(const TensorMeta& meta, int ax, std::function<double(double, double)> op,
-                                   bool keepDims = false, double initVal = 0) {
+    template <typename Op>
+    static TensorMeta reduceSingle(const TensorMeta& meta, int ax, Op&& op, bool keepDims = false,
+                                   double initVal = 0) {
         auto [jump, numBatches, incrementBatchIdx, outShape] = fetchReduceAxInfo(meta, ax, keepDims);
-        TensorMeta out(outShape);
+        TensorMeta out = TensorMeta::uninit(outShape);
         out.updateAll(initVal);
 
-        for (int idx = 0; idx < meta.numel; ++idx) {
-            int outIdx = ((idx / incrementBatchIdx) * jump) + (idx % jump);
-            out.rawData[outIdx] = op(out.rawData[outIdx], meta.rawData[idx]);
+        // Each batch reduces into its own jump-sized output slab, so the
+        // batch loop is race-free to parallelize and the slab loops below
+        // need no per-element division to find the output index.
+        int axExtent = meta.tensorSize[ax];
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(configuredThreads()) schedule(static) if (configuredThreads() > 1 && numBatches > 1)
+#endif
+        for (int batchIdx = 0; batchIdx < numBatches; ++batchIdx) {
+            const double* src = meta.rawData.data() + batchIdx * incrementBatchIdx;
+            double* dst = out.rawData.data() + batchIdx * jump;
+            for (int r = 0; r < axExtent; ++r) {
+                for (int j = 0; j < jump; ++j) {
+                    dst[j] = op(dst[j], src[r * jump + j]);
+                }
+            }
         }
 
         return out;
     }
 
+    /**
+     * @brief Sums a tensor down to a broadcast-compatible target shape in one pass.
+     *
+     * Gradient accumulation previously reduced broadcast axes with one sum()
+     * call and leading added axes with a second, each walking the whole
+     * buffer and allocating a temporary. This walks the source exactly once:
+     * axes the target lacks (or holds with size 1) contribute stride 0 to the
+     * output index, which is maintained incrementally by the odometer carry
+     * loop, so every source element is added straight into its target slot.
+     *
+     * @param src The (broadcast-shaped) source tensor.
+     * @param targetShape The shape to reduce to; must be broadcast-compatible
+     * with the source when right-aligned.
+     * @return The reduced tensor with the target shape.
+     */
+    static TensorMeta reduceToShape(const TensorMeta& src, const std::vector<int>& targetShape) {
+        TensorMeta out(targetShape);
+        reduceIntoShape(src, out, false);
+        return out;
+    }
+
+    /**
+     * @brief Sums a tensor down to dst's shape, accumulating straight into it.
+     *
+     * The gradient path used to materialize the reduced tensor and then add
+     * it to the accumulator - one temporary buffer plus a second full pass.
+     * Reducing directly into the existing accumulator (optionally with the
+     * sign folded in) makes a broadcast backward edge a single sweep over the
+     * incoming gradient with no allocation at all.
+     *
+     * @param src The (broadcast-shaped) source tensor.
+     * @param dst The accumulator; its shape must be broadcast-compatible with
+     * the source when right-aligned.
+     * @param negate If true the source is subtracted instead of added.
+     */
+    static void reduceIntoShape(const TensorMeta& src, TensorMeta& dst, bool negate) {
+        const std::vector<int>& targetShape = dst.tensorSize;
+        int shift = src.ndim() - int(targetShape.size());
+        std::vector<int> outStride = fetchStride(targetShape);
+        std::vector<int> contrib(src.ndim(), 0);
+        for (int dim = shift; dim < src.ndim(); ++dim) {
+            bool reduced = (targetShape[dim - shift] == 1 && src.tensorSize[dim] != 1);
+            contrib[dim] = reduced ? 0 : outStride[dim - shift];
+        }
+
+        // The innermost extent runs contiguously (its contribution is 0 or
+        // 1): a reduced inner axis accumulates into a local before one store,
+        // a kept one is a straight element loop, and the carry branch only
+        // fires once per row.
+        const double sign = negate ? -1.0 : 1.0;
+        int innerN = src.tensorSize.back();
+        int innerC = contrib[src.ndim() - 1];
+        std::vector<int> indices(src.ndim(), 0);
+        int outIdx = 0;
+        for (long long idx = 0; idx < src.numel; idx += innerN) {
+            if (innerC == 0) {
+                double acc = 0.0;
+                for (int j = 0; j < innerN; ++j) {
+                    acc += src.rawData[idx + j];
+                }
+                dst.rawData[outIdx] += sign * acc;
+            } else {
+                for (int j = 0; j < innerN; ++j) {
+                    dst.rawData[outIdx + j] += sign * src.rawData[idx + j];
+                }
+            }
+
+            for (int dim = src.ndim() - 2; dim >= 0; --dim) {
+                indices[dim]++;
+                outIdx += contrib[dim];
+                if (indices[dim] < src.tensorSize[dim]) {
+                    break;
+                }
+                indices[dim] = 0;
+                outIdx -= contrib[dim] * src.tensorSize[dim];
+            }
+        }
+    }
+
+    /**
+     * @brief Fused broadcast mul backward: dst += reduce(src * factor).
+     *
+     * The broadcast multiply edge used to materialize src * factor at full
+     * output shape and then reduce that temporary into the accumulator - two
+     * sweeps and an allocation. This walks the output index space once with
+     * the same odometer carry loop, reading the factor through stride-0 axes
+     * where it was broadcast and accumulating the product straight into dst.
+     *
+     * @param src The incoming gradient, already at the full broadcast shape.
+     * @param factor The other operand's data; broadcast-compatible with src.
+     * @param dst The accumulator; broadcast-compatible with src.
+     * @param negate If true the products are subtracted instead of added.
+     */
+    static void reduceProductIntoShape(const TensorMeta& src, const TensorMeta& factor, TensorMeta& dst, bool negate) {
+        const std::vector<int>& outShape = dst.tensorSize;
+        const std::vector<int>& facShape = factor.tensorSize;
+        int outShift = src.ndim() - int(outShape.size());
+        int facShift = src.ndim() - int(facShape.size());
+        std::vector<int> outStride = fetchStride(outShape);
+        std::vector<int> facStride = fetchStride(facShape);
+        std::vector<int> outContrib(src.ndim(), 0), facContrib(src.ndim(), 0);
+        for (int dim = 0; dim < src.ndim(); ++dim) {
+            if (dim >= outShift && !(outShape[dim - outShift] == 1 && src.tensorSize[dim] != 1))
+                outContrib[dim] = outStride[dim - outShift];
+            if (dim >= facShift && !(facShape[dim - facShift] == 1 && src.tensorSize[dim] != 1))
+                facContrib[dim] = facStride[dim - facShift];
+        }
+
+        // Same innermost-run hoist as reduceIntoShape: strides there are 0 or
+        // 1, so a reduced inner axis folds into a local accumulator and the
+        // carry branch drops off the per-element path.
+        const double sign = negate ? -1.0 : 1.0;
+        int innerN = src.tensorSize.back();
+        int innerOutC = outContrib[src.ndim() - 1];
+        int innerFacC = facContrib[src.ndim() - 1];
+        std::vector<int> indices(src.ndim(), 0);
+        int outIdx = 0, facIdx = 0;
+        for (long long idx = 0; idx < src.numel; idx += innerN) {
+            if (innerOutC == 0) {
+                double acc = 0.0;
+                for (int j = 0; j < innerN; ++j) {
+                    acc += src.rawData[idx + j] * factor.rawData[facIdx + j * innerFacC];
+                }
+                dst.rawData[outIdx] += sign * acc;
+            } else {
+                for (int j = 0; j < innerN; ++j) {
+                    dst.rawData[outIdx + j] += sign * src.rawData[idx + j] * factor.rawData[facIdx + j * innerFacC];
+                }
+            }
+
+            for (int dim = src.ndim() - 2; dim >= 0; --dim) {
+                indices[dim]++;
+                outIdx += outContrib[dim];
+                facIdx += facContrib[dim];
+                if (indices[dim] < src.tensorSize[dim]) {
+                    break;
+                }
+                indices[dim] = 0;
+                outIdx -= outContrib[dim] * src.tensorSize[dim];
+                facIdx -= facContrib[dim] * src.tensorSize[dim];
+            }
+        }
+    }
+
     static TensorMeta sum(const TensorMeta& meta, std::vector<int> dims = {}, bool keepDims = false) {
-        std::function<double(double, double)> op = [](double a, double b) { return a + b; };
+        // A full reduction is just a horizontal add over the flat buffer; skip
+        // the axis-by-axis passes and their intermediate tensors entirely.
+        if (dims.empty() && !keepDims) {
+            return TensorMeta(vecSumF64(meta.rawData.data(), meta.rawData.size()));
+        }
+        // Reducing only the innermost axis makes every output element a
+        // horizontal add over one contiguous row; each row runs through the
+        // SIMD sum kernel instead of the scalar slab walk. Row length must
+        // be a multiple of eight doubles so row bases keep the alignment the
+        // kernel loads with.
+        if (dims.size() == 1 && meta.ndim() > 1 && dims[0] == meta.ndim() - 1 &&
+            (meta.tensorSize.back() & 7) == 0) {
+            const int rowN = meta.tensorSize.back();
+            const long long rows = meta.numel / rowN;
+            std::vector<int> outShape(meta.tensorSize);
+            if (keepDims) {
+                outShape.back() = 1;
+            } else {
+                outShape.pop_back();
+            }
+            TensorMeta out = TensorMeta::uninit(outShape);
+            for (long long row = 0; row < rows; ++row) {
+                out.rawData[row] = vecSumF64(meta.rawData.data() + row * rowN, rowN);
+            }
+            return out;
+        }
+        auto op = [](double a, double b) { return a + b; };
         return reduce(meta, dims, op, keepDims);
     }
 
+    /**
+     * @brief Fused squared-error reduction: sum((a - b)^2) as a scalar tensor.
+     *
+     * The expression form materializes the difference and its square before
+     * summing - three passes and two temporaries. This is one streaming FMA
+     * pass over both inputs. Shapes must match.
+     *
+     * @param a The first tensor.
+     * @param b The second tensor.
+     * @return A one-element tensor holding the sum of squared differences.
+     */
+    static TensorMeta mseSum(const TensorMeta& a, const TensorMeta& b) {
+        assert(a.tensorSize == b.tensorSize);
+        return TensorMeta(mseSumF64(a.rawData.data(), b.rawData.data(), a.rawData.size()));
+    }
+
     static TensorMeta max(const TensorMeta& meta, std::vector<int> dims = {}, bool keepDims = false) {
-        std::function<double(double, double)> op = [](double a, double b) { return std::max(a, b); };
+        auto op = [](double a, double b) { return std::max(a, b); };
         return reduce(meta, dims, op, keepDims);
     }
 
     static TensorMeta min(const TensorMeta& meta, std::vector<int> dims = {}, bool keepDims = false) {
-        std::function<double(double, double)> op = [](double a, double b) { return std::min(a, b); };
+        auto op = [](double a, double b) { return std::min(a, b); };
         return reduce(meta, dims, op, keepDims, DOUBLE_MAX);
     }
 
@@ -1039,38 +2195,93 @@ class TensorMeta {
      */
     TensorMeta permute(std::vector<int> perm) const {
         int n = ndim();
-        assert(perm.size() == n && "Permutation Size Should Match with Original TensorMeta Size!");
-        std::vector<int> indices(n, 0);
+        assert(int(perm.size()) == n && "Permutation Size Should Match with Original TensorMeta Size!");
+
+        // Identity permutations fall out of the matmul plumbing (1-D/2-D
+        // unsqueeze chains) all the time; a plain buffer copy beats walking
+        // the odometer to produce the same bytes.
+        bool identity = true;
+        for (int dim = 0; identity && dim < n; ++dim) {
+            identity = perm[dim] == dim;
+        }
+        if (identity) {
+            return *this;
+        }
+
         std::vector<int> newShape(n, 0);
-        std::vector<double> rawDataCopy(numel, -1);
-        for (int dim = 0; dim < newShape.size(); dim++) {
+        for (int dim = 0; dim < n; dim++) {
             newShape[dim] = tensorSize[perm[dim]];
         }
-
-        std::vector<int> stride = fetchStride(tensorSize);
         std::vector<int> newStride = fetchStride(newShape);
 
-        for (int ix = 0; ix < numel; ++ix) {
-            std::vector<int> newIndices(n, -1);
+        // By far the most common permutation is swapping the last two dims
+        // (matmul backward, T() on matrices). That case runs cache-blocked:
+        // both sides of each TILE x TILE square stay resident in L1, instead
+        // of the write striding a full row length between consecutive
+        // elements across the whole matrix.
+        bool lastTwoSwap = n >= 2 && perm[n - 2] == n - 1 && perm[n - 1] == n - 2;
+        for (int dim = 0; lastTwoSwap && dim < n - 2; ++dim) {
+            lastTwoSwap = perm[dim] == dim;
+        }
+        if (lastTwoSwap) {
+            constexpr int kTile = 32;
+            int rows = tensorSize[n - 2], cols = tensorSize[n - 1];
+            long long batches = numel / (rows * cols);
+            TensorMeta out = TensorMeta::uninit(newShape);
+            // Each batch transposes into its own slab, so the batch loop
+            // parallelizes without coordination.
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(configuredThreads()) schedule(static) if (configuredThreads() > 1 && batches > 1)
+#endif
+            for (long long batchIdx = 0; batchIdx < batches; ++batchIdx) {
+                const double* src = rawData.data() + batchIdx * rows * cols;
+                double* dst = out.rawData.data() + batchIdx * rows * cols;
+                for (int i0 = 0; i0 < rows; i0 += kTile) {
+                    int iEnd = std::min(i0 + kTile, rows);
+                    for (int j0 = 0; j0 < cols; j0 += kTile) {
+                        int jEnd = std::min(j0 + kTile, cols);
+                        for (int i = i0; i < iEnd; ++i) {
+                            for (int j = j0; j < jEnd; ++j) {
+                                dst[j * rows + i] = src[i * cols + j];
+                            }
+                        }
+                    }
+                }
+            }
+            return out;
+        }
 
-            // Fetch new multi indices
-            for (int dim = 0; dim < newShape.size(); dim++) {
-                newIndices[dim] = indices[perm[dim]];
+        // contrib[d] is the destination stride of source dim d: walking the
+        // source linearly, the destination index is then carried by the same
+        // odometer pattern as the reduction kernels, with the innermost
+        // source run hoisted - no per-element index vector or getIndex call.
+        std::vector<int> contrib(n, 0);
+        for (int dim = 0; dim < n; dim++) {
+            contrib[perm[dim]] = newStride[dim];
+        }
+
+        TensorMeta out = TensorMeta::uninit(newShape);
+        int innerN = tensorSize[n - 1];
+        int innerC = contrib[n - 1];
+        std::vector<int> indices(n, 0);
+        int dstIdx = 0;
+        for (long long idx = 0; idx < numel; idx += innerN) {
+            for (int j = 0; j < innerN; ++j) {
+                out.rawData[dstIdx + j * innerC] = rawData[idx + j];
             }
-            // Prepare flattened index and assign to new memory chunk
-            int newIndex = getIndex(newIndices, newShape, newStride);
-            rawDataCopy[newIndex] = rawData[ix];
 
-            for (int dim = n - 1; dim >= 0; dim--) {
+            for (int dim = n - 2; dim >= 0; --dim) {
                 indices[dim]++;
+                dstIdx += contrib[dim];
                 if (indices[dim] < tensorSize[dim]) {
                     break;
                 }
                 indices[dim] = 0;
+                dstIdx -= contrib[dim] * tensorSize[dim];
             }
         }
 
-        return TensorMeta(rawDataCopy, newShape);
+        return out;
     }
 
     /**
@@ -1080,13 +2291,15 @@ class TensorMeta {
      * @return The transposed tensor metadata.
      */
     TensorMeta transpose(int dim1 = -1, int dim2 = -2) {
-        std::vector<int> perm = arange(0, ndim());
-        // printVec(perm);
         if (dim1 < 0)
             dim1 = ndim() + dim1;
         if (dim2 < 0)
             dim2 = ndim() + dim2;
+        if (dim1 == dim2) {
+            return *this;
+        }
 
+        std::vector<int> perm = arange(0, ndim());
         std::iter_swap(perm.begin() + dim1, perm.begin() + dim2);
 
         return permute(perm);
@@ -1097,6 +2310,10 @@ class TensorMeta {
      * @return The transposed tensor metadata.
      */
     TensorMeta T() {
+        if (ndim() <= 1) {
+            return *this;
+        }
+
         std::vector<int> perm = arange(0, ndim());
         std::reverse(perm.begin(), perm.end());
 
@@ -7,7 +7,7 @@
 /**
  * @brief Generates a range of integers from startIndex to endIndex.
  */
-std::vector<int> arange(int startIndex, int endIndex) {
+inline std::vector<int> arange(int startIndex, int endIndex) {
     std::vector<int> v(endIndex - startIndex, 0);
     std::iota(v.begin(), v.end(), startIndex);
 
@@ -17,7 +17,7 @@ std::vector<int> arange(int startIndex, int endIndex) {
 /**
  * @brief Prints a vector of integers.
  */
-void printVec(const std::vector<int>& vec) {
+inline void printVec(const std::vector<int>& vec) {
     std::cout << "[ ";
     for (int i = 0; i < vec.size() - 1; i++) {
         std::cout << vec[i] << ", ";
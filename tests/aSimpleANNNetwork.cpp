@@ -66,20 +66,20 @@ int main() {
         w2.zeroGrad(), b2.zeroGrad();
 
         // Make Predictions from the ANN
-        Tensor hidden = relu(Tensor::matmul(X, w1.T()) + b1);
+        Tensor hidden = relu(Tensor::matmulNT(X, w1) + b1);
         hidden.updateTag("Hidden");
 
-        Tensor pred = Tensor::matmul(hidden, w2.T()) + b2;
+        Tensor pred = Tensor::matmulNT(hidden, w2) + b2;
         pred.updateTag("pred");
 
-        // Loss Function (MSE)
-        Tensor diff = (pred - y).pow(2);
-        diff.updateTag("MSE");
+        // Loss Function (MSE) - fused sub + square + sum in one pass
+        Tensor loss = Tensor::mseLoss(pred, y);
+        loss.updateTag("MSE");
 
-        std::cout << "Loss at step " << step << " : " << double(diff.fetchData().sum()) << "\n";
+        std::cout << "Loss at step " << step << " : " << double(loss.fetchData()) << "\n";
 
         // Run BackPropagation
-        diff.backward();
+        loss.backward();
 
         // Update Grads
         w1.updateData(w1.fetchData() - (w1.fetchGrad() * lr));